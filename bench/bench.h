@@ -0,0 +1,94 @@
+#pragma once
+// Microbenchmark harness. BENCHMARK(group) registers a function that calls Runner::Measure for
+// each case and size; results are written as JSON (schema "rlx-bench/1") for tools/compare_bench.py.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace rlxbench {
+	template<typename T>
+	inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+
+	struct Result {
+		std::string name;
+		size_t size = 0;
+		uint64_t iterations = 0;
+		double nsPerOp = 0.0;		// median sample
+		double nsPerOpMin = 0.0;
+	};
+
+	class Runner {
+	public:
+		bool quick = false;
+		double minTimeMs = 200.0;
+		std::string filter;
+
+		// Picks the full or quick variant of a size list
+		std::vector<size_t> Sizes(std::initializer_list<size_t> full, std::initializer_list<size_t> reduced) const {
+			return quick ? std::vector<size_t>(reduced) : std::vector<size_t>(full);
+		}
+
+		bool Selected(const std::string& name) const { return filter.empty() || name.find(filter) != std::string::npos; }
+
+		// Times fn(), which performs `ops` operations per call. Five samples of at least minTime / 5 each.
+		void Measure(const std::string& name, size_t size, size_t ops, const std::function<void()>& fn) {
+			if (!Selected(name)) return;
+			using Clock = std::chrono::steady_clock;
+
+			fn();	// warm-up
+			uint64_t batch = 1;
+			const double sampleNs = minTimeMs * 1e6 / Samples;
+			for (;;) {
+				auto t0 = Clock::now();
+				for (uint64_t i = 0; i < batch; ++i) fn();
+				double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+				if (ns >= sampleNs || batch >= (1ull << 30)) break;
+				batch = ns <= 0 ? batch * 10 : std::max<uint64_t>(batch + 1, static_cast<uint64_t>(batch * sampleNs / ns * 1.1));
+			}
+
+			std::vector<double> samples;
+			for (int s = 0; s < Samples; ++s) {
+				auto t0 = Clock::now();
+				for (uint64_t i = 0; i < batch; ++i) fn();
+				double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+				samples.push_back(ns / (static_cast<double>(batch) * std::max<size_t>(ops, 1)));
+			}
+			std::sort(samples.begin(), samples.end());
+			results.push_back({ name, size, batch * Samples, samples[Samples / 2], samples.front() });
+		}
+
+		std::vector<Result> results;
+
+	private:
+		static constexpr int Samples = 5;
+	};
+
+	struct Group {
+		const char* name;
+		void (*fn)(Runner&);
+	};
+
+	inline std::vector<Group>& Groups() {
+		static std::vector<Group> groups;
+		return groups;
+	}
+
+	struct Registrar {
+		Registrar(const char* name, void (*fn)(Runner&)) { Groups().push_back({ name, fn }); }
+	};
+}
+
+#define BENCHMARK(group) \
+	static void group##_bench(rlxbench::Runner&); \
+	static rlxbench::Registrar group##_bench_registrar(#group, &group##_bench); \
+	static void group##_bench(rlxbench::Runner& runner)
@@ -0,0 +1,204 @@
+#include "bench.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	std::vector<std::string> MakeKeys(size_t n) {
+		std::vector<std::string> keys;
+		keys.reserve(n);
+		for (size_t i = 0; i < n; ++i)
+			keys.push_back("entity/" + std::to_string(i * 2654435761u % (n * 4 + 1)) + "/" + std::to_string(i));
+		return keys;
+	}
+
+	class EmptyLayer : public Core::Layer {
+	public:
+		explicit EmptyLayer(int id) { Identifier = "bench" + std::to_string(id); }
+		void OnUpdate() override {}
+		void OnRender() override { DrawRectangle(0, 0, 1, 1, WHITE); }
+	};
+}
+
+BENCHMARK(OrderedMap)
+{
+	for (size_t n : runner.Sizes({ 1000, 100000, 1000000 }, { 1000 })) {
+		const std::vector<std::string> keys = MakeKeys(n);
+
+		runner.Measure("ordered_map/insert_string", n, n, [&] {
+			ordered_map<std::string, int> map;
+			for (size_t i = 0; i < n; ++i) map.push_back(keys[i], static_cast<int>(i));
+			rlxbench::DoNotOptimize(map.size());
+		});
+
+		ordered_map<std::string, int> map;
+		for (size_t i = 0; i < n; ++i) map.push_back(keys[i], static_cast<int>(i));
+		runner.Measure("ordered_map/find_string", n, n, [&] {
+			int sum = 0;
+			for (size_t i = 0; i < n; ++i) sum += map.find(keys[i])->second;
+			rlxbench::DoNotOptimize(sum);
+		});
+
+		runner.Measure("ordered_map/iterate", n, n, [&] {
+			size_t sum = 0;
+			for (const auto& [key, value] : map) sum += key.size() + value;
+			rlxbench::DoNotOptimize(sum);
+		});
+
+		runner.Measure("ordered_map/insert_int", n, n, [&] {
+			ordered_map<uint32_t, uint32_t> ints;
+			for (size_t i = 0; i < n; ++i) ints.push_back(static_cast<uint32_t>(i), static_cast<uint32_t>(i));
+			rlxbench::DoNotOptimize(ints.size());
+		});
+	}
+
+	// erase reindexes the whole map, so only small sizes
+	for (size_t n : runner.Sizes({ 100, 1000, 10000 }, { 100 })) {
+		const std::vector<std::string> keys = MakeKeys(n);
+		runner.Measure("ordered_map/erase_half", n, n / 2, [&] {
+			ordered_map<std::string, int> map;
+			for (size_t i = 0; i < n; ++i) map.push_back(keys[i], static_cast<int>(i));
+			for (size_t i = 0; i < n; i += 2) map.erase(keys[i]);
+			rlxbench::DoNotOptimize(map.size());
+		});
+	}
+}
+
+BENCHMARK(Rectangle)
+{
+	for (size_t n : runner.Sizes({ 1000, 1000000 }, { 1000 })) {
+		std::vector<rlx::Rectangle<float>> rects(n);
+		for (size_t i = 0; i < n; ++i)
+			rects[i] = rlx::Rectangle<float>((float)(i % 1000), (float)(i / 1000 % 1000), 8.0f, 8.0f);
+		const rlx::Rectangle<float> view(200.0f, 200.0f, 320.0f, 180.0f);
+
+		runner.Measure("rectangle/intersects", n, n, [&] {
+			size_t hits = 0;
+			for (const auto& r : rects) hits += r.intersects(view);
+			rlxbench::DoNotOptimize(hits);
+		});
+
+		runner.Measure("rectangle/contains", n, n, [&] {
+			size_t hits = 0;
+			for (const auto& r : rects) hits += view.contains(r.x, r.y);
+			rlxbench::DoNotOptimize(hits);
+		});
+
+		const rlx::Padding<float> pad{ 1.0f, 2.0f, 3.0f, 4.0f };
+		runner.Measure("rectangle/padding", n, n, [&] {
+			float sum = 0.0f;
+			for (const auto& r : rects) sum += (r + pad).width + (r - pad).height;
+			rlxbench::DoNotOptimize(sum);
+		});
+	}
+}
+
+BENCHMARK(Color)
+{
+	for (size_t n : runner.Sizes({ 1000, 1000000 }, { 1000 })) {
+		runner.Measure("color/rgb_convert", n, n, [&] {
+			uint32_t sum = 0;
+			for (size_t i = 0; i < n; ++i) {
+				rlx::RGB c((uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16));
+				Color raw = c;
+				sum += (uint8_t)c + (uint16_t)c + raw.g;
+			}
+			rlxbench::DoNotOptimize(sum);
+		});
+
+		runner.Measure("color/rgba_convert", n, n, [&] {
+			uint32_t sum = 0;
+			for (size_t i = 0; i < n; ++i) {
+				rlx::RGBA c((uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16), (uint8_t)(i >> 3));
+				Color raw = c;
+				sum += (uint32_t)c + raw.a;
+			}
+			rlxbench::DoNotOptimize(sum);
+		});
+	}
+}
+
+BENCHMARK(Directory)
+{
+	for (size_t n : runner.Sizes({ 10, 100, 1000 }, { 10 })) {
+		auto dir = std::filesystem::temp_directory_path() / ("rlx_bench_dir_" + std::to_string(n));
+		std::filesystem::remove_all(dir);
+		std::filesystem::create_directories(dir);
+		for (size_t i = 0; i < n; ++i)
+			std::ofstream(dir / (std::to_string(i) + (i % 2 ? ".png" : ".txt")));
+
+		runner.Measure("directory/get_files", n, n, [&] {
+			rlxbench::DoNotOptimize(rlx::Directory::GetFiles(dir).size());
+		});
+		runner.Measure("directory/get_files_ext", n, n, [&] {
+			rlxbench::DoNotOptimize(rlx::Directory::GetFilesWithExtension(dir, ".png").size());
+		});
+
+		rlx::FrameArena arena;
+		runner.Measure("directory/get_files_arena", n, n, [&] {
+			arena.NextFrame();
+			rlxbench::DoNotOptimize(rlx::Directory::GetFiles(dir, &arena).size());
+		});
+		std::filesystem::remove_all(dir);
+	}
+}
+
+BENCHMARK(Application)
+{
+	constexpr int Frames = 1000;
+	Core::Application::InitializeComponents(640, 360, "bench");
+	HeadlessSetFrameTime(1.0f / 60.0f);
+
+	for (size_t layers : runner.Sizes({ 0, 1, 16 }, { 0, 1 })) {
+		for (size_t i = 0; i < layers; ++i)
+			Core::Application::Add<EmptyLayer>(static_cast<int>(i));
+
+		runner.Measure("application/frame", layers, Frames, [&] {
+			HeadlessSetFrameLimit(Frames);
+			Core::Application::Run();
+		});
+
+		for (size_t i = 0; i < layers; ++i)
+			Core::Application::Remove<EmptyLayer>();
+	}
+}
+
+BENCHMARK(FrameArena)
+{
+	for (size_t n : runner.Sizes({ 16, 256, 4096 }, { 16 })) {
+		runner.Measure("frame_arena/pmr_vectors", n, n, [&] {
+			static rlx::FrameArena arena;
+			arena.NextFrame();
+			for (size_t i = 0; i < n; ++i) {
+				std::pmr::vector<int> v(&arena);
+				v.resize(32);
+				rlxbench::DoNotOptimize(v.data());
+			}
+		});
+		runner.Measure("frame_arena/heap_vectors", n, n, [&] {
+			for (size_t i = 0; i < n; ++i) {
+				std::vector<int> v(32);
+				rlxbench::DoNotOptimize(v.data());
+			}
+		});
+	}
+}
+
+BENCHMARK(ImageView)
+{
+	rlx::Managed<Image> atlas(GenImageColor(1024, 1024, WHITE));
+	for (size_t cell : runner.Sizes({ 16, 64 }, { 64 })) {
+		const int c = static_cast<int>(cell);
+		const size_t cells = (1024 / cell) * (1024 / cell);
+		runner.Measure("image/slice_copy", cell, cells, [&] {
+			for (int y = 0; y + c <= 1024; y += c)
+				for (int x = 0; x + c <= 1024; x += c) {
+					rlx::Managed<Image> part(ImageFromImage(atlas, rlRectangle{ (float)x, (float)y, (float)c, (float)c }));
+					rlxbench::DoNotOptimize(part->data);
+				}
+		});
+		runner.Measure("image/slice_view", cell, cells, [&] {
+			std::vector<rlx::ImageView> parts = rlx::ImageView(atlas).Slice(c, c);
+			rlxbench::DoNotOptimize(parts.data());
+		});
+	}
+}
@@ -0,0 +1,115 @@
+#include "bench.h"
+#include "raylib_include.h"
+#include <charconv>
+
+namespace {
+	// Line-based "key value" text, the format registries were persisted in before snapshots
+	void WriteText(const std::filesystem::path& path, const ordered_map<std::string, int>& map) {
+		std::ofstream out(path, std::ios::binary);
+		for (const auto& [key, value] : map)
+			out << key << ' ' << value << '\n';
+	}
+
+	ordered_map<std::string, int> ParseText(const std::filesystem::path& path) {
+		std::ifstream in(path, std::ios::binary);
+		std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		ordered_map<std::string, int> map;
+		std::string_view rest(text);
+		while (!rest.empty()) {
+			size_t eol = rest.find('\n');
+			std::string_view line = rest.substr(0, eol);
+			rest = eol == std::string_view::npos ? std::string_view() : rest.substr(eol + 1);
+			size_t space = line.rfind(' ');
+			if (space == std::string_view::npos) continue;
+			int value = 0;
+			std::from_chars(line.data() + space + 1, line.data() + line.size(), value);
+			map.push_back(std::string(line.substr(0, space)), std::move(value));
+		}
+		return map;
+	}
+}
+
+BENCHMARK(Culling)
+{
+	Mesh mesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+	Material material = LoadMaterialDefault();
+
+	for (size_t n : runner.Sizes({ 10000, 1000000 }, { 10000 })) {
+		rlx::InstanceBatch batch(mesh, material);
+		batch.Reserve(n);
+		uint64_t seed = 1;
+		auto next = [&]() { seed = seed * 6364136223846793005ull + 1442695040888963407ull; return (float)((seed >> 40) % 20000) / 10.0f - 1000.0f; };
+		for (size_t i = 0; i < n; ++i)
+			batch.Add(MatrixTranslate(next(), next() * 0.05f, next()));
+
+		Camera3D camera{ { 0, 20, -100 }, { 0, 0, 0 }, { 0, 1, 0 }, 60.0f, CAMERA_PERSPECTIVE };
+		rlx::Frustum frustum = rlx::Frustum::FromCamera(camera, 16.0f / 9.0f);
+		runner.Measure("instance_batch/cull", n, n, [&] {
+			batch.Cull(frustum, camera.position);
+			rlxbench::DoNotOptimize(batch.GetVisibleCount());
+		});
+	}
+
+	UnloadMaterial(material);
+	UnloadMesh(mesh);
+}
+
+BENCHMARK(Particles)
+{
+	for (size_t n : runner.Sizes({ 10000, 1000000 }, { 10000 })) {
+		rlx::ParticleSystem particles(n);
+		rlx::ParticleEmitter emitter;
+		emitter.velocityMin = { -50.0f, -50.0f };
+		emitter.velocityMax = { 50.0f, 50.0f };
+		emitter.lifetimeMin = 1e6f;	// nothing expires while measuring
+		emitter.lifetimeMax = 1e6f;
+		particles.Emit(emitter, n);
+		particles.SetGravity({ 0.0f, 98.0f });
+
+		runner.Measure("particles/update", n, n, [&] {
+			particles.Update(1.0f / 60.0f);
+			rlxbench::DoNotOptimize(particles.Size());
+		});
+	}
+}
+
+BENCHMARK(Serialization)
+{
+	for (size_t n : runner.Sizes({ 10000, 1000000 }, { 10000 })) {
+		ordered_map<std::string, int> map;
+		for (size_t i = 0; i < n; ++i)
+			map.push_back("entity/" + std::to_string(i), static_cast<int>(i));
+
+		auto dir = std::filesystem::temp_directory_path();
+		auto textPath = dir / ("rlx_bench_" + std::to_string(n) + ".txt");
+		auto snapPath = dir / ("rlx_bench_" + std::to_string(n) + ".rlxs");
+		WriteText(textPath, map);
+		rlx::Snapshot::Writer writer;
+		writer.WriteMap("registry", map);
+		writer.Save(snapPath);
+
+		runner.Measure("serialization/text_load", n, n, [&] {
+			rlxbench::DoNotOptimize(ParseText(textPath).size());
+		});
+
+		runner.Measure("serialization/snapshot_view", n, n, [&] {
+			rlx::Snapshot::Reader reader(snapPath);
+			auto view = reader.GetMap<std::string, int>("registry");
+			rlxbench::DoNotOptimize(view.size());
+		});
+
+		runner.Measure("serialization/snapshot_to_map", n, n, [&] {
+			rlx::Snapshot::Reader reader(snapPath);
+			rlxbench::DoNotOptimize(reader.GetMap<std::string, int>("registry").to_ordered_map().size());
+		});
+
+		runner.Measure("serialization/snapshot_write", n, n, [&] {
+			rlx::Snapshot::Writer w;
+			w.WriteMap("registry", map);
+			rlxbench::DoNotOptimize(w.Finish().size());
+		});
+
+		std::filesystem::remove(textPath);
+		std::filesystem::remove(snapPath);
+	}
+}
@@ -0,0 +1,64 @@
+#include "bench.h"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+// rlx_bench [--quick] [--filter=substring] [--min-time=ms] [--out=file.json]
+int main(int argc, char** argv)
+{
+	rlxbench::Runner runner;
+	std::string out;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--quick") runner.quick = true;
+		else if (arg.rfind("--filter=", 0) == 0) runner.filter = arg.substr(9);
+		else if (arg.rfind("--min-time=", 0) == 0) runner.minTimeMs = std::stod(arg.substr(11));
+		else if (arg.rfind("--out=", 0) == 0) out = arg.substr(6);
+		else {
+			std::fprintf(stderr, "usage: %s [--quick] [--filter=substring] [--min-time=ms] [--out=file.json]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	for (const rlxbench::Group& group : rlxbench::Groups()) {
+		size_t before = runner.results.size();
+		group.fn(runner);
+		for (size_t i = before; i < runner.results.size(); ++i) {
+			const rlxbench::Result& r = runner.results[i];
+			std::fprintf(stderr, "%-40s %10zu %14.2f ns/op\n", r.name.c_str(), r.size, r.nsPerOp);
+		}
+	}
+
+	std::ostringstream json;
+	char date[32];
+	std::time_t now = std::time(nullptr);
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+	json << "{\n  \"schema\": \"rlx-bench/1\",\n";
+	json << "  \"context\": { \"date\": \"" << date << "\", \"threads\": " << std::thread::hardware_concurrency()
+		<< ", \"quick\": " << (runner.quick ? "true" : "false") << " },\n";
+	json << "  \"results\": [\n";
+	for (size_t i = 0; i < runner.results.size(); ++i) {
+		const rlxbench::Result& r = runner.results[i];
+		json << "    { \"name\": \"" << r.name << "\", \"size\": " << r.size << ", \"iterations\": " << r.iterations
+			<< ", \"ns_per_op\": " << r.nsPerOp << ", \"ns_per_op_min\": " << r.nsPerOpMin << " }"
+			<< (i + 1 < runner.results.size() ? ",\n" : "\n");
+	}
+	json << "  ]\n}\n";
+
+	if (out.empty()) {
+		std::cout << json.str();
+	}
+	else {
+		std::ofstream file(out);
+		file << json.str();
+		if (!file) {
+			std::fprintf(stderr, "failed to write %s\n", out.c_str());
+			return 1;
+		}
+	}
+	return runner.results.empty() ? 1 : 0;
+}
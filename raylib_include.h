@@ -21,6 +21,11 @@
 	#undef ShowCursor
 	#undef DrawText
 	#undef DrawTextEx
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
 #endif
 #define Rectangle rlRectangle
 extern "C" {
@@ -30,12 +35,35 @@ extern "C" {
 #include "raymath.h"
 #undef Rectangle
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <memory_resource>
 #include <functional>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <tuple>
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <limits>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <new>
+#include <cstddef>
+#include <chrono>
+#include <ctime>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RLX_SSE2
+	#include <emmintrin.h>
+#endif
 
 template<typename K, typename V>
 class ordered_map {
@@ -297,9 +325,9 @@ namespace rlx {
 		return (static_cast<uint8_t>(value) & static_cast<uint8_t>(flag)) != 0;
 	}
 
-	inline Vector2 GetAlignedPosition(const char* text, rlRectangle rec, float fontsize, float spacing, TextAlign align)
+	inline Vector2 GetAlignedPosition(const Font& font, const char* text, rlRectangle rec, float fontsize, float spacing, TextAlign align)
 	{
-		Vector2 measure = MeasureTextEx(GetFontDefault(), text, fontsize, spacing);
+		Vector2 measure = MeasureTextEx(font, text, fontsize, spacing);
 		float posX = rec.x;
 		float posY = rec.y;
 
@@ -316,6 +344,11 @@ namespace rlx {
 		return { posX, posY };
 	}
 
+	inline Vector2 GetAlignedPosition(const char* text, rlRectangle rec, float fontsize, float spacing, TextAlign align)
+	{
+		return GetAlignedPosition(GetFontDefault(), text, rec, fontsize, spacing, align);
+	}
+
 	inline void DrawTextAligned(const char* text, rlRectangle rec, float fontsize, Color rgba, TextAlign align)
 	{
 		Vector2 pos = GetAlignedPosition(text, rec, fontsize, 0.0f, align);
@@ -329,7 +362,7 @@ namespace rlx {
 
 	inline void DrawTextAlignedEx(const Font& font, const char* text, rlRectangle rec, float fontsize, float spacing, Color rgba, TextAlign align)
 	{
-		Vector2 pos = GetAlignedPosition(text, rec, fontsize, spacing, align);
+		Vector2 pos = GetAlignedPosition(font, text, rec, fontsize, spacing, align);
 		DrawTextEx(font, text, { pos.x, pos.y }, fontsize, spacing, rgba);
 	}
 
@@ -487,6 +520,8 @@ namespace rlx {
 		constexpr T bottom() const {
 			return y + height;
 		}
+
+		constexpr bool operator==(const Rectangle&) const = default;
 	};
 
 	template<typename T>
@@ -573,6 +608,326 @@ namespace rlx {
 		}
 	};
 
+	enum class FlexDirection : uint8_t {
+		Row,
+		Column
+	};
+
+	template<typename T>
+		requires std::is_integral_v<T> || std::is_floating_point_v<T>
+	struct LayoutStyle {
+		FlexDirection direction = FlexDirection::Row;
+		T width{};	// 0 = sized from content
+		T height{};	// 0 = sized from content
+		float grow = 0.0f;
+		float shrink = 1.0f;
+		T gap{};
+		Padding<T> padding{};
+		Margin<T> margin{};
+		// Containers: main axis flag justifies (none = start), cross axis flag aligns (none = stretch).
+		// Text leaves: passed straight to DrawTextAlignedEx.
+		TextAlign align = TextAlign::None;
+		bool hidden = false;
+	};
+
+	template<typename T>
+		requires std::is_integral_v<T> || std::is_floating_point_v<T>
+	class Layout {
+	public:
+		using NodeId = uint32_t;
+		static constexpr NodeId InvalidNode = std::numeric_limits<NodeId>::max();
+		static constexpr NodeId Root = 0;
+
+		explicit Layout(const LayoutStyle<T>& rootStyle = {}) {
+			m_nodes.push_back(Node{ .style = rootStyle });
+		}
+
+		// --- Tree building ---
+		NodeId AddNode(NodeId parent, const LayoutStyle<T>& style = {}) {
+			CheckNode(parent);
+			NodeId id = static_cast<NodeId>(m_nodes.size());
+			m_nodes.push_back(Node{ .style = style, .parent = parent });
+
+			Node& p = m_nodes[parent];
+			if (p.lastChild == InvalidNode) p.firstChild = id;
+			else m_nodes[p.lastChild].nextSibling = id;
+			p.lastChild = id;
+
+			MarkDirty(parent);
+			return id;
+		}
+
+		NodeId AddText(NodeId parent, std::string text, float fontSize, float spacing = 0.0f, const Font* font = nullptr, const LayoutStyle<T>& style = {}) {
+			NodeId id = AddNode(parent, style);
+			m_nodes[id].text = static_cast<uint32_t>(m_texts.size());
+			m_texts.push_back(TextLeaf{ std::move(text), font, fontSize, spacing });
+			return id;
+		}
+
+		void Reserve(size_t nodes) { m_nodes.reserve(nodes); }
+
+		void Clear() {
+			LayoutStyle<T> rootStyle = m_nodes[Root].style;
+			m_nodes.clear();
+			m_texts.clear();
+			m_nodes.push_back(Node{ .style = rootStyle });
+		}
+
+		// --- Mutation (marks the node and its ancestors dirty) ---
+		LayoutStyle<T>& EditStyle(NodeId id) {
+			CheckNode(id);
+			MarkDirty(id);
+			return m_nodes[id].style;
+		}
+
+		void SetText(NodeId id, std::string_view text) {
+			TextLeaf& leaf = GetTextLeaf(id);
+			if (leaf.text == text) return;
+			leaf.text.assign(text);
+			MarkDirty(id);
+		}
+
+		void SetFont(NodeId id, const Font* font, float fontSize, float spacing = 0.0f) {
+			TextLeaf& leaf = GetTextLeaf(id);
+			leaf.font = font;
+			leaf.fontSize = fontSize;
+			leaf.spacing = spacing;
+			MarkDirty(id);
+		}
+
+		void MarkDirty(NodeId id) {
+			// Hidden subtrees are skipped by Compute() and keep their flags, so the node itself may already be
+			// dirty without its ancestors being so. From the parent up, stop at the first one already marked.
+			m_nodes[id].dirty = true;
+			m_nodes[id].measureDirty = true;
+			id = m_nodes[id].parent;
+			while (id != InvalidNode && !m_nodes[id].dirty) {
+				m_nodes[id].dirty = true;
+				m_nodes[id].measureDirty = true;
+				id = m_nodes[id].parent;
+			}
+		}
+
+		// --- Layout ---
+		void Compute(const Rectangle<T>& bounds) {
+			Measure(Root);
+			Arrange(Root, bounds + m_nodes[Root].style.margin);
+		}
+
+		// --- Results ---
+		const LayoutStyle<T>& GetStyle(NodeId id) const { CheckNode(id); return m_nodes[id].style; }
+		const Box<T>& GetBox(NodeId id) const { CheckNode(id); return m_nodes[id].box; }
+		Rectangle<T> GetRect(NodeId id) const { return GetBox(id).rect; }
+		Rectangle<T> GetContentRect(NodeId id) const { return GetBox(id).with_padding(); }
+		bool IsDirty(NodeId id) const { CheckNode(id); return m_nodes[id].dirty; }
+		NodeId GetParent(NodeId id) const { CheckNode(id); return m_nodes[id].parent; }
+		NodeId GetFirstChild(NodeId id) const { CheckNode(id); return m_nodes[id].firstChild; }
+		NodeId GetNextSibling(NodeId id) const { CheckNode(id); return m_nodes[id].nextSibling; }
+		bool IsText(NodeId id) const { CheckNode(id); return m_nodes[id].text != InvalidNode; }
+		size_t Size() const { return m_nodes.size(); }
+
+		void DrawText(NodeId id, Color color) const {
+			CheckNode(id);
+			const Node& n = m_nodes[id];
+			if (n.text == InvalidNode || n.style.hidden) return;
+			const TextLeaf& leaf = m_texts[n.text];
+			DrawTextAlignedEx(leaf.font ? *leaf.font : GetFontDefault(), leaf.text.c_str(), GetContentRect(id), leaf.fontSize, leaf.spacing, color, n.style.align);
+		}
+
+	private:
+		struct Node {
+			LayoutStyle<T> style{};
+			NodeId parent = InvalidNode;
+			NodeId firstChild = InvalidNode;
+			NodeId lastChild = InvalidNode;
+			NodeId nextSibling = InvalidNode;
+			uint32_t text = InvalidNode;
+			Box<T> box{};
+			float measuredWidth = 0.0f;
+			float measuredHeight = 0.0f;
+			bool dirty = true;
+			bool measureDirty = true;
+		};
+
+		struct TextLeaf {
+			std::string text;
+			const Font* font = nullptr;
+			float fontSize = 10.0f;
+			float spacing = 0.0f;
+		};
+
+		void CheckNode(NodeId id) const {
+			if (id >= m_nodes.size())
+				throw std::out_of_range("Invalid layout node.");
+		}
+
+		TextLeaf& GetTextLeaf(NodeId id) {
+			CheckNode(id);
+			if (m_nodes[id].text == InvalidNode)
+				throw std::invalid_argument("Layout node is not a text node.");
+			return m_texts[m_nodes[id].text];
+		}
+
+		static T FromFloat(float v) {
+			if constexpr (std::is_integral_v<T>) return static_cast<T>(std::lround(v));
+			else return static_cast<T>(v);
+		}
+
+		static float MainMargin(const Margin<T>& m, bool row) {
+			return row ? static_cast<float>(m.left + m.right) : static_cast<float>(m.top + m.bottom);
+		}
+
+		static float CrossMargin(const Margin<T>& m, bool row) {
+			return row ? static_cast<float>(m.top + m.bottom) : static_cast<float>(m.left + m.right);
+		}
+
+		// Intrinsic border-box size (margins excluded), cached until the node is marked dirty
+		void Measure(NodeId id) {
+			Node& n = m_nodes[id];
+			if (!n.measureDirty) return;
+
+			float width = static_cast<float>(n.style.width);
+			float height = static_cast<float>(n.style.height);
+			const bool fixed = width != 0.0f && height != 0.0f;
+			float contentW = 0.0f;
+			float contentH = 0.0f;
+			if (n.text != InvalidNode) {
+				if (!fixed) {
+					const TextLeaf& leaf = m_texts[n.text];
+					Vector2 size = MeasureTextEx(leaf.font ? *leaf.font : GetFontDefault(), leaf.text.c_str(), leaf.fontSize, leaf.spacing);
+					contentW = size.x;
+					contentH = size.y;
+				}
+			}
+			else {
+				// Children are measured even when this node's size is fixed, since Arrange uses their sizes
+				bool row = n.style.direction == FlexDirection::Row;
+				float main = 0.0f;
+				float cross = 0.0f;
+				int visible = 0;
+				for (NodeId c = n.firstChild; c != InvalidNode; c = m_nodes[c].nextSibling) {
+					if (m_nodes[c].style.hidden) continue;
+					Measure(c);
+					if (fixed) continue;
+					const Node& child = m_nodes[c];
+					main += (row ? child.measuredWidth : child.measuredHeight) + MainMargin(child.style.margin, row);
+					cross = std::max(cross, (row ? child.measuredHeight : child.measuredWidth) + CrossMargin(child.style.margin, row));
+					++visible;
+				}
+				if (visible > 1)
+					main += static_cast<float>(n.style.gap) * (visible - 1);
+				contentW = row ? main : cross;
+				contentH = row ? cross : main;
+			}
+			if (width == 0.0f) width = contentW + static_cast<float>(n.style.padding.left + n.style.padding.right);
+			if (height == 0.0f) height = contentH + static_cast<float>(n.style.padding.top + n.style.padding.bottom);
+
+			n.measuredWidth = width;
+			n.measuredHeight = height;
+			n.measureDirty = false;
+		}
+
+		void Translate(NodeId id, T dx, T dy) {
+			Node& n = m_nodes[id];
+			n.box.rect.x += dx;
+			n.box.rect.y += dy;
+			for (NodeId c = n.firstChild; c != InvalidNode; c = m_nodes[c].nextSibling)
+				Translate(c, dx, dy);
+		}
+
+		void Arrange(NodeId id, const Rectangle<T>& rect) {
+			Node& n = m_nodes[id];
+			if (!n.dirty) {
+				if (n.box.rect == rect)
+					return;
+				if (n.box.rect.width == rect.width && n.box.rect.height == rect.height) {
+					Translate(id, rect.x - n.box.rect.x, rect.y - n.box.rect.y);
+					return;
+				}
+			}
+
+			n.box = Box<T>{ rect, n.style.padding, n.style.margin };
+			n.dirty = false;
+			if (n.firstChild == InvalidNode)
+				return;
+
+			const Rectangle<T> content = n.box.with_padding();
+			const bool row = n.style.direction == FlexDirection::Row;
+			const float available = static_cast<float>(row ? content.width : content.height);
+			const float crossAvailable = static_cast<float>(row ? content.height : content.width);
+			const float gap = static_cast<float>(n.style.gap);
+
+			// Pass 1: totals over the flow so pass 2 can size each child without scratch storage
+			float used = 0.0f;
+			float growSum = 0.0f;
+			float shrinkSum = 0.0f;
+			int visible = 0;
+			for (NodeId c = n.firstChild; c != InvalidNode; c = m_nodes[c].nextSibling) {
+				const Node& child = m_nodes[c];
+				if (child.style.hidden) continue;
+				float basis = row ? child.measuredWidth : child.measuredHeight;
+				used += basis + MainMargin(child.style.margin, row);
+				growSum += child.style.grow;
+				shrinkSum += child.style.shrink * basis;
+				++visible;
+			}
+			if (visible > 1)
+				used += gap * (visible - 1);
+
+			const float free = available - used;
+			float cursor = static_cast<float>(row ? content.x : content.y);
+			if (free > 0.0f && growSum == 0.0f) {
+				bool center = row ? HasFlag(n.style.align, HorizontalAlign::Center) : HasFlag(n.style.align, VerticalAlign::Middle);
+				bool end = row ? HasFlag(n.style.align, HorizontalAlign::Right) : HasFlag(n.style.align, VerticalAlign::Bottom);
+				if (center) cursor += free * 0.5f;
+				else if (end) cursor += free;
+			}
+
+			const bool crossCenter = row ? HasFlag(n.style.align, VerticalAlign::Middle) : HasFlag(n.style.align, HorizontalAlign::Center);
+			const bool crossEnd = row ? HasFlag(n.style.align, VerticalAlign::Bottom) : HasFlag(n.style.align, HorizontalAlign::Right);
+			const bool crossStart = row ? HasFlag(n.style.align, VerticalAlign::Top) : HasFlag(n.style.align, HorizontalAlign::Left);
+			const float crossOrigin = static_cast<float>(row ? content.y : content.x);
+
+			// Pass 2: size and place
+			for (NodeId c = n.firstChild; c != InvalidNode; c = m_nodes[c].nextSibling) {
+				const Node& child = m_nodes[c];
+				if (child.style.hidden) continue;
+
+				const Margin<T>& m = child.style.margin;
+				const float leadMargin = static_cast<float>(row ? m.left : m.top);
+				const float crossLeadMargin = static_cast<float>(row ? m.top : m.left);
+				const float crossMargin = CrossMargin(m, row);
+
+				float basis = row ? child.measuredWidth : child.measuredHeight;
+				float size = basis;
+				if (free > 0.0f && growSum > 0.0f)
+					size += free * (child.style.grow / growSum);
+				else if (free < 0.0f && shrinkSum > 0.0f)
+					size = std::max(0.0f, size + free * (child.style.shrink * basis / shrinkSum));
+
+				float crossSize = row ? child.measuredHeight : child.measuredWidth;
+				float crossPos = crossOrigin + crossLeadMargin;
+				if (crossCenter)
+					crossPos += (crossAvailable - crossSize - crossMargin) * 0.5f;
+				else if (crossEnd)
+					crossPos += crossAvailable - crossSize - crossMargin;
+				else if (!crossStart && static_cast<float>(row ? child.style.height : child.style.width) == 0.0f)
+					crossSize = std::max(0.0f, crossAvailable - crossMargin);
+
+				float mainPos = cursor + leadMargin;
+				cursor += size + MainMargin(m, row) + gap;
+
+				Rectangle<T> childRect = row
+					? Rectangle<T>{ FromFloat(mainPos), FromFloat(crossPos), FromFloat(size), FromFloat(crossSize) }
+					: Rectangle<T>{ FromFloat(crossPos), FromFloat(mainPos), FromFloat(crossSize), FromFloat(size) };
+				Arrange(c, childRect);
+			}
+		}
+
+		std::vector<Node> m_nodes;
+		std::vector<TextLeaf> m_texts;
+	};
+
 	namespace File
 	{
 		inline bool Exists(const std::filesystem::path& filePath) {
@@ -615,34 +970,51 @@ namespace rlx {
 			return std::filesystem::remove(dirPath);
 		}
 
-		inline std::vector<std::filesystem::path> GetFiles(const std::filesystem::path& dirPath) {
-			std::vector<std::filesystem::path> files;
-			for (const auto& entry : std::filesystem::directory_iterator(dirPath)) {
-				if (entry.is_regular_file()) {
-					files.push_back(entry.path());
+		namespace detail
+		{
+			// Appends every entry of dirPath that passes keep to out; shared by the std and pmr overloads
+			template<typename Vector, typename Keep>
+			Vector Collect(const std::filesystem::path& dirPath, Vector out, Keep keep) {
+				for (const auto& entry : std::filesystem::directory_iterator(dirPath)) {
+					if (keep(entry)) {
+						out.push_back(entry.path());
+					}
 				}
+				return out;
 			}
-			return files;
+
+			inline bool IsFile(const std::filesystem::directory_entry& entry) { return entry.is_regular_file(); }
+			inline bool IsDirectory(const std::filesystem::directory_entry& entry) { return entry.is_directory(); }
+		}
+
+		inline std::vector<std::filesystem::path> GetFiles(const std::filesystem::path& dirPath) {
+			return detail::Collect(dirPath, std::vector<std::filesystem::path>(), detail::IsFile);
 		}
 
 		inline std::vector<std::filesystem::path> GetDirectories(const std::filesystem::path& dirPath) {
-			std::vector<std::filesystem::path> directories;
-			for (const auto& entry : std::filesystem::directory_iterator(dirPath)) {
-				if (entry.is_directory()) {
-					directories.push_back(entry.path());
-				}
-			}
-			return directories;
+			return detail::Collect(dirPath, std::vector<std::filesystem::path>(), detail::IsDirectory);
 		}
 
 		inline std::vector<std::filesystem::path> GetFilesWithExtension(const std::filesystem::path& dirPath, const std::string& extension) {
-			std::vector<std::filesystem::path> files;
-			for (const auto& entry : std::filesystem::directory_iterator(dirPath)) {
-				if (entry.is_regular_file() && entry.path().extension() == extension) {
-					files.push_back(entry.path());
-				}
-			}
-			return files;
+			return detail::Collect(dirPath, std::vector<std::filesystem::path>(), [&](const std::filesystem::directory_entry& entry) {
+				return entry.is_regular_file() && entry.path().extension() == extension;
+			});
+		}
+
+		// Overloads that place the result vector in a caller-supplied resource (e.g. the frame arena).
+		// The path objects themselves still allocate from the global heap.
+		inline std::pmr::vector<std::filesystem::path> GetFiles(const std::filesystem::path& dirPath, std::pmr::memory_resource* resource) {
+			return detail::Collect(dirPath, std::pmr::vector<std::filesystem::path>(resource), detail::IsFile);
+		}
+
+		inline std::pmr::vector<std::filesystem::path> GetDirectories(const std::filesystem::path& dirPath, std::pmr::memory_resource* resource) {
+			return detail::Collect(dirPath, std::pmr::vector<std::filesystem::path>(resource), detail::IsDirectory);
+		}
+
+		inline std::pmr::vector<std::filesystem::path> GetFilesWithExtension(const std::filesystem::path& dirPath, const std::string& extension, std::pmr::memory_resource* resource) {
+			return detail::Collect(dirPath, std::pmr::vector<std::filesystem::path>(resource), [&](const std::filesystem::directory_entry& entry) {
+				return entry.is_regular_file() && entry.path().extension() == extension;
+			});
 		}
 	}
 
@@ -787,15 +1159,17 @@ namespace rlx {
 		return { offsetX, offsetY, renderW, renderH };
 	}
 
-	inline void EndUpscaleRender(RenderTexture2D target, Color background = BLACK, std::function<void()> before = nullptr, std::function<void()> after = nullptr)
+	// Callback overload without std::function wrappers; picked whenever both hooks are callables
+	template<typename Before, typename After>
+		requires std::invocable<Before&> && std::invocable<After&>
+	inline void EndUpscaleRender(RenderTexture2D target, Color background, Before&& before, After&& after)
 	{
 		EndMode2D();
 		EndTextureMode();
 		auto [offsetX, offsetY, renderW, renderH] = GetUpscaledTargetArea(target.texture.width, target.texture.height);
 		BeginDrawing();
 		ClearBackground(background);
-		if (before)
-			before();
+		before();
 		DrawTexturePro(
 			target.texture,
 			{ 0, 0, (float)target.texture.width, -(float)target.texture.height },
@@ -804,182 +1178,4681 @@ namespace rlx {
 			0,
 			WHITE
 		);
-		if (after)
-			after();
+		after();
 		EndDrawing();
 	}
-}
-namespace Core
-{
-	class Layer {
-	public:
-		Layer() = default;
-		virtual ~Layer() = default;
-		virtual void OnShow() {}
-		virtual void OnUpdate() = 0;
-		virtual void OnRender() = 0;
-		virtual void OnRender_Before_Unscaled() {}
-		virtual void OnRender_After_Unscaled() {}
 
-		std::string Identifier = "";
-	};
+	inline void EndUpscaleRender(RenderTexture2D target, Color background = BLACK, std::function<void()> before = nullptr, std::function<void()> after = nullptr)
+	{
+		EndUpscaleRender(target, background, [&]() { if (before) before(); }, [&]() { if (after) after(); });
+	}
 
-	class Window {
+	// N voices aliasing one sample buffer (LoadSoundAlias). Play() does not allocate.
+	class SoundPool {
 	public:
-		~Window() {
-			if (IsWindowReady())
-				CloseWindow();
+		SoundPool() = default;
+
+		SoundPool(const char* fileName, int voices, int maxConcurrent = 0) {
+			Managed<Wave> wave(fileName);
+			Load(wave, voices, maxConcurrent);
 		}
 
-		inline static std::unique_ptr<Window> Create(
-			int width = 800,
-			int height = 600,
-			const std::string& title = "Raylib Window")
+		SoundPool(const Wave& wave, int voices, int maxConcurrent = 0) {
+			Load(wave, voices, maxConcurrent);
+		}
+
+		SoundPool(const SoundPool&) = delete;
+		SoundPool& operator=(const SoundPool&) = delete;
+
+		SoundPool(SoundPool&& other) noexcept
+			: m_source(std::move(other.m_source)), m_voices(std::move(other.m_voices)),
+			  m_maxConcurrent(other.m_maxConcurrent), m_sequence(other.m_sequence),
+			  m_stolen(other.m_stolen), m_rejected(other.m_rejected)
 		{
-			return std::make_unique<Window>(width, height, title);
+			other.m_voices.clear();
 		}
 
-		void AddFlag(unsigned int flag) { flags |= flag; }
-		void ClearFlags() { flags = 0; }
+		SoundPool& operator=(SoundPool&& other) noexcept {
+			if (this != &other) {
+				Unload();
+				m_source = std::move(other.m_source);
+				m_voices = std::move(other.m_voices);
+				m_maxConcurrent = other.m_maxConcurrent;
+				m_sequence = other.m_sequence;
+				m_stolen = other.m_stolen;
+				m_rejected = other.m_rejected;
+				other.m_voices.clear();
+			}
+			return *this;
+		}
 
-		void Show() {
-			if (!IsWindowReady())
-			{
-#ifdef _WIN32
-				SetProcessDPIAware();
-#endif
-				ApplyFlags();
-				InitWindow(width, height, title.c_str());
+		~SoundPool() { Unload(); }
+
+		void Load(const Wave& wave, int voices, int maxConcurrent = 0) {
+			if (voices <= 0)
+				throw std::invalid_argument("SoundPool requires at least one voice.");
+
+			Unload();
+			m_source = Managed<Sound>(wave);
+			m_voices.resize(static_cast<size_t>(voices));
+			m_voices[0].sound = m_source;
+			for (size_t i = 1; i < m_voices.size(); ++i)
+				m_voices[i].sound = LoadSoundAlias(m_source);
+			SetMaxConcurrent(maxConcurrent);
+		}
+
+		void Unload() {
+			if (m_voices.empty()) return;
+			StopAll();
+			for (size_t i = 1; i < m_voices.size(); ++i)
+				UnloadSoundAlias(m_voices[i].sound);
+			m_voices.clear();
+			m_source.Unload();
+		}
+
+		// Returns the voice index, or -1 when every candidate outranks the request
+		int Play(int priority = 0, float volume = 1.0f, float pitch = 1.0f, float pan = 0.5f) {
+			if (m_voices.empty()) return -1;
+
+			int active = 0;
+			int freeVoice = -1;
+			int victim = -1;
+			for (size_t i = 0; i < m_voices.size(); ++i) {
+				Voice& voice = m_voices[i];
+				if (!IsSoundPlaying(voice.sound)) {
+					if (freeVoice < 0) freeVoice = static_cast<int>(i);
+					continue;
+				}
+				++active;
+				if (victim < 0 || voice.priority < m_voices[victim].priority ||
+					(voice.priority == m_voices[victim].priority && voice.sequence < m_voices[victim].sequence))
+					victim = static_cast<int>(i);
 			}
+
+			int index = freeVoice;
+			if (active >= m_maxConcurrent || index < 0) {
+				// Steal the lowest priority voice, oldest first
+				if (victim < 0 || m_voices[victim].priority > priority) {
+					++m_rejected;
+					return -1;
+				}
+				StopSound(m_voices[victim].sound);
+				++m_stolen;
+				index = victim;
+			}
+
+			Voice& voice = m_voices[index];
+			voice.priority = priority;
+			voice.sequence = ++m_sequence;
+			SetSoundVolume(voice.sound, volume);
+			SetSoundPitch(voice.sound, pitch);
+			SetSoundPan(voice.sound, pan);
+			PlaySound(voice.sound);
+			return index;
 		}
 
-		bool IsReady() const { return IsWindowReady(); }
-		bool ShouldClose() const { return WindowShouldClose(); }
+		void Stop(int voice) {
+			if (voice >= 0 && voice < GetVoiceCount())
+				StopSound(m_voices[voice].sound);
+		}
 
-		void SetTitle(const std::string& newTitle) { SetWindowTitle(newTitle.c_str()); }
-		void SetSize(int w, int h) { SetWindowSize(w, h); }
-		void SetPosition(int x, int y) { SetWindowPosition(x, y); }
-		void Focus() { SetWindowFocused(); }
-		void Maximize() { MaximizeWindow(); }
-		void Minimize() { MinimizeWindow(); }
-		void Restore() { RestoreWindow(); }
-		void ToggleFullscreen() { ::ToggleFullscreen(); }
+		void StopAll() {
+			for (Voice& voice : m_voices)
+				StopSound(voice.sound);
+		}
 
-		Vector2 GetPosition() const { return GetWindowPosition(); }
-		Vector2 GetSize() const { return { (float)GetScreenWidth(), (float)GetScreenHeight() }; }
+		bool IsPlaying(int voice) const {
+			return voice >= 0 && voice < GetVoiceCount() && IsSoundPlaying(m_voices[voice].sound);
+		}
 
-#ifdef _WIN32
-		HWND GetHandle() const { return (HWND)GetWindowHandle(); }
-#endif
+		int GetActiveVoices() const {
+			int active = 0;
+			for (const Voice& voice : m_voices)
+				if (IsSoundPlaying(voice.sound)) ++active;
+			return active;
+		}
 
-		Window(int w, int h, const std::string& t)
-			: width(w), height(h), title(t), flags(0) {
+		// 0 or anything above the voice count means every voice may play at once
+		void SetMaxConcurrent(int maxConcurrent) {
+			m_maxConcurrent = (maxConcurrent <= 0 || maxConcurrent > GetVoiceCount()) ? GetVoiceCount() : maxConcurrent;
 		}
 
+		int GetMaxConcurrent() const { return m_maxConcurrent; }
+		int GetVoiceCount() const { return static_cast<int>(m_voices.size()); }
+		uint64_t GetStolenCount() const { return m_stolen; }
+		uint64_t GetRejectedCount() const { return m_rejected; }
+		bool IsLoaded() const { return m_source.IsLoaded(); }
+
 	private:
-		int width;
-		int height;
-		std::string title;
-		unsigned int flags;
+		struct Voice {
+			Sound sound{};
+			int priority = 0;
+			uint64_t sequence = 0;
+		};
+
+		Managed<Sound> m_source{};	// voice 0, owns the sample buffer
+		std::vector<Voice> m_voices;
+		int m_maxConcurrent = 0;
+		uint64_t m_sequence = 0;
+		uint64_t m_stolen = 0;
+		uint64_t m_rejected = 0;
+	};
 
-		void ApplyFlags() {
-			if (flags != 0)
-				SetConfigFlags(flags);
+	// Single-producer/single-consumer ring; Push from one thread, Pop from another, no locks
+	template<typename T>
+		requires std::is_trivially_copyable_v<T>
+	class SpscRingBuffer {
+	public:
+		explicit SpscRingBuffer(size_t capacity = 0) { Reset(capacity); }
+
+		SpscRingBuffer(const SpscRingBuffer&) = delete;
+		SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+		// Not thread-safe, call while neither side is running. Capacity rounds up to a power of two.
+		void Reset(size_t capacity) {
+			size_t cap = 1;
+			while (cap < capacity) cap <<= 1;
+			m_buffer.assign(capacity ? cap : 0, T{});
+			m_mask = cap - 1;
+			m_head.store(0, std::memory_order_relaxed);
+			m_tail.store(0, std::memory_order_relaxed);
+		}
+
+		// Producer side, returns the number of elements actually written
+		size_t Push(const T* data, size_t count) {
+			const size_t head = m_head.load(std::memory_order_relaxed);
+			const size_t tail = m_tail.load(std::memory_order_acquire);
+			count = std::min(count, m_buffer.size() - (head - tail));
+			if (count == 0) return 0;
+
+			const size_t start = head & m_mask;
+			const size_t first = std::min(count, m_buffer.size() - start);
+			std::memcpy(m_buffer.data() + start, data, first * sizeof(T));
+			std::memcpy(m_buffer.data(), data + first, (count - first) * sizeof(T));
+			m_head.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+		// Consumer side, returns the number of elements actually read
+		size_t Pop(T* out, size_t count) {
+			const size_t tail = m_tail.load(std::memory_order_relaxed);
+			const size_t head = m_head.load(std::memory_order_acquire);
+			count = std::min(count, head - tail);
+			if (count == 0) return 0;
+
+			const size_t start = tail & m_mask;
+			const size_t first = std::min(count, m_buffer.size() - start);
+			std::memcpy(out, m_buffer.data() + start, first * sizeof(T));
+			std::memcpy(out + first, m_buffer.data(), (count - first) * sizeof(T));
+			m_tail.store(tail + count, std::memory_order_release);
+			return count;
 		}
+
+		size_t Size() const {
+			return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+		}
+
+		size_t Available() const { return m_buffer.size() - Size(); }
+		size_t Capacity() const { return m_buffer.size(); }
+		bool Empty() const { return Size() == 0; }
+
+	private:
+		alignas(64) std::atomic<size_t> m_head{ 0 };
+		alignas(64) std::atomic<size_t> m_tail{ 0 };
+		alignas(64) std::vector<T> m_buffer;
+		size_t m_mask = 0;
 	};
 
-	class Application {
-	public:
-		bool UpscaleEnabled = false;
-		uint8_t UpscaleFactor = 1;
-		rlx::Managed<RenderTexture2D> UpscaleTexture{};
-		Color ClearBackgroundColor = BLACK;
+	// Mixes interleaved stereo float sources into one stereo buffer. No raylib calls, so it runs headless.
+	class AudioMixer {
 	public:
-		static void InitializeComponents(
-			int width = 800,
-			int height = 600,
-			const std::string& title = "Raylib Application")
-		{
-			auto& app = Instance();
-			if (!app.window)
-				app.window = Window::Create(width, height, title);
+		struct Source {
+			SpscRingBuffer<float> ring;
+			std::atomic<float> gain{ 1.0f };
+			std::atomic<float> pan{ 0.5f };	// 0.0 = left, 0.5 = center, 1.0 = right (raylib convention)
+			std::atomic<bool> active{ true };
+			std::atomic<uint64_t> underruns{ 0 };
+
+			explicit Source(size_t capacity) : ring(capacity) {}
+		};
+
+		explicit AudioMixer(size_t maxFrames = 4096) : m_scratch(maxFrames * 2) {}
+
+		// Not thread-safe, add sources before mixing starts
+		size_t AddSource(size_t capacityFrames) {
+			m_sources.push_back(std::make_unique<Source>(capacityFrames * 2));
+			return m_sources.size() - 1;
 		}
 
-		static Window* GetWindow() {
-			return Instance().window.get();
+		Source& GetSource(size_t index) { return *m_sources.at(index); }
+		const Source& GetSource(size_t index) const { return *m_sources.at(index); }
+		size_t GetSourceCount() const { return m_sources.size(); }
+
+		// Producer side helper, returns the number of whole frames queued
+		size_t Push(size_t index, const float* frames, size_t frameCount) {
+			return GetSource(index).ring.Push(frames, frameCount * 2) / 2;
 		}
 
-		static void Run(std::function<void()> loop = nullptr) {
-			auto& app = Instance();
+		void SetGain(size_t index, float gain) { GetSource(index).gain.store(gain, std::memory_order_relaxed); }
+		void SetPan(size_t index, float pan) { GetSource(index).pan.store(std::clamp(pan, 0.0f, 1.0f), std::memory_order_relaxed); }
+		void SetActive(size_t index, bool active) { GetSource(index).active.store(active, std::memory_order_relaxed); }
 
-			if (!app.window)
-				throw std::runtime_error("Application window does not exist.");
+		uint64_t GetUnderruns(size_t index) const { return GetSource(index).underruns.load(std::memory_order_relaxed); }
 
-			if (!app.window->IsReady()) {
-				app.window->Show();
-				for (auto& [_, layer] : app.m_Layers)
-					layer->OnShow();
+		uint64_t GetTotalUnderruns() const {
+			uint64_t total = 0;
+			for (const auto& source : m_sources)
+				total += source->underruns.load(std::memory_order_relaxed);
+			return total;
+		}
+
+		// Consumer side. Writes frameCount stereo frames (frameCount * 2 floats) to out.
+		void Mix(float* out, size_t frameCount) {
+			if (frameCount * 2 > m_scratch.size())
+				throw std::invalid_argument("AudioMixer::Mix frame count exceeds maxFrames.");
+
+			const size_t samples = frameCount * 2;
+			std::fill(out, out + samples, 0.0f);
+
+			for (auto& source : m_sources) {
+				size_t got = source->ring.Pop(m_scratch.data(), std::min(samples, source->ring.Size() & ~size_t(1)));
+				if (got < samples && source->active.load(std::memory_order_relaxed))
+					source->underruns.fetch_add(1, std::memory_order_relaxed);
+				if (got == 0) continue;
+
+				float gain = source->gain.load(std::memory_order_relaxed);
+				float pan = source->pan.load(std::memory_order_relaxed);
+				float gainL = gain * std::min(1.0f, 2.0f * (1.0f - pan));
+				float gainR = gain * std::min(1.0f, 2.0f * pan);
+				Accumulate(out, m_scratch.data(), got, gainL, gainR);
 			}
 
-			while (app.window && !app.window->ShouldClose()) {
-				if (loop) loop();
-				else {
-					for (auto& [_, layer] : app.m_Layers)
-						layer->OnUpdate();
+			Clamp(out, samples);
+		}
 
-					if (app.UpscaleEnabled && app.UpscaleTexture.IsLoaded()) {
-						rlx::BeginUpscaleRender(app.UpscaleTexture, (float)app.UpscaleFactor);
-						ClearBackground(app.ClearBackgroundColor);
-						for (auto& [_, layer] : app.m_Layers)
-							layer->OnRender();
-						rlx::EndUpscaleRender(app.UpscaleTexture, app.ClearBackgroundColor, [&]() {
-								for (auto& [_, layer] : app.m_Layers)
-									layer->OnRender_Before_Unscaled();
-							},
-							[&]() {
-								for (auto& [_, layer] : app.m_Layers)
-									layer->OnRender_After_Unscaled();
-							});
-					}
-					else {
-						BeginDrawing();
-						ClearBackground(app.ClearBackgroundColor);
-						for (auto& [_, layer] : app.m_Layers)
-							layer->OnRender();
-						EndDrawing();
-					}
-				}
+	private:
+		static void Accumulate(float* dst, const float* src, size_t samples, float gainL, float gainR) {
+			size_t i = 0;
+#ifdef RLX_SSE2
+			const __m128 gain = _mm_setr_ps(gainL, gainR, gainL, gainR);
+			for (; i + 4 <= samples; i += 4)
+				_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), gain)));
+#endif
+			for (; i + 2 <= samples; i += 2) {
+				dst[i] += src[i] * gainL;
+				dst[i + 1] += src[i + 1] * gainR;
 			}
 		}
 
+		static void Clamp(float* data, size_t samples) {
+			size_t i = 0;
+#ifdef RLX_SSE2
+			const __m128 lo = _mm_set1_ps(-1.0f);
+			const __m128 hi = _mm_set1_ps(1.0f);
+			for (; i + 4 <= samples; i += 4)
+				_mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lo), hi));
+#endif
+			for (; i < samples; ++i)
+				data[i] = std::clamp(data[i], -1.0f, 1.0f);
+		}
 
-		template<typename TLayer, typename... Args>
-		static void Add(Args&&... args)
-		{
-			static_assert(std::is_base_of_v<Core::Layer, TLayer>,
-				"TLayer must derive from Core::Layer");
+		std::vector<std::unique_ptr<Source>> m_sources;
+		std::vector<float> m_scratch;
+	};
 
-			auto& app = Instance();
-			uint32_t id = static_cast<uint32_t>(app.m_Layers.size());
+	struct AudioFeederConfig {
+		unsigned int sampleRate = 48000;
+		unsigned int framesPerBuffer = 1024;	// device buffer size, sets output latency
+		unsigned int bufferDepth = 4;			// ring depth per source, in device buffers
+		unsigned int defaultBufferFrames = 0;	// raylib's stream buffer default, restored after Start() (0: device chooses)
+		std::chrono::microseconds pollInterval{ 2000 };
+	};
 
-			auto layer = std::make_unique<TLayer>(std::forward<Args>(args)...);
-			if (layer->Identifier.empty())
-				throw std::invalid_argument("Layer Identifier was not set.");
+	// Keeps music and audio streams fed from a dedicated thread instead of the render loop
+	class AudioFeeder {
+	public:
+		explicit AudioFeeder(const AudioFeederConfig& config = {})
+			: m_config(config), m_mixer(config.framesPerBuffer), m_mixBuffer(config.framesPerBuffer * 2) {}
 
-			for (auto& [key, existing] : app.m_Layers)
-			{
-				if (existing && existing->Identifier == layer->Identifier)
-					throw std::invalid_argument("Duplicate layer identifier: " + layer->Identifier);
-			}
+		~AudioFeeder() { Stop(); }
 
-			app.m_Layers.emplace(id, std::move(layer));
+		AudioFeeder(const AudioFeeder&) = delete;
+		AudioFeeder& operator=(const AudioFeeder&) = delete;
+
+		// Mixed source; push interleaved stereo float frames through GetMixer().Push()
+		size_t AddSource() {
+			if (IsRunning())
+				throw std::runtime_error("AudioFeeder sources must be added before Start().");
+			return m_mixer.AddSource(static_cast<size_t>(m_config.framesPerBuffer) * m_config.bufferDepth);
 		}
 
-		template<typename TLayer>
-			requires(std::is_base_of_v<Core::Layer, TLayer>)
-		static void Remove()
-		{
-			auto& app = Instance();
+		// Float stream sized to framesPerBuffer, for AddStream(stream, GetConfig().framesPerBuffer)
+		Managed<AudioStream> LoadStream(unsigned int channels) const {
+			SetAudioStreamBufferSizeDefault(static_cast<int>(m_config.framesPerBuffer));
+			Managed<AudioStream> stream(m_config.sampleRate, 32, channels);
+			SetAudioStreamBufferSizeDefault(static_cast<int>(m_config.defaultBufferFrames));
+			return stream;
+		}
+
+		// Direct stream fed from its own ring, bypassing the mixer. Stream must use 32-bit float samples.
+		// bufferFrames is the size the stream was loaded with; raylib drops updates larger than that.
+		size_t AddStream(const AudioStream& stream, unsigned int bufferFrames) {
+			if (IsRunning())
+				throw std::runtime_error("AudioFeeder streams must be added before Start().");
+			if (stream.sampleSize != 32)
+				throw std::invalid_argument("AudioFeeder streams must use 32-bit float samples.");
+			if (bufferFrames == 0)
+				throw std::invalid_argument("AudioFeeder streams need their buffer size in frames.");
+			m_streams.push_back(std::make_unique<DirectStream>(stream, static_cast<size_t>(bufferFrames) * m_config.bufferDepth, bufferFrames));
+			return m_streams.size() - 1;
+		}
+
+		// Producer side for AddStream(), returns the number of whole frames queued
+		size_t PushStream(size_t index, const float* frames, size_t frameCount) {
+			DirectStream& direct = *m_streams.at(index);
+			return direct.ring.Push(frames, frameCount * direct.stream.channels) / direct.stream.channels;
+		}
+
+		// Music is decoded on the feeder thread; remove it before unloading
+		void AddMusic(const Music& music) {
+			std::lock_guard<std::mutex> lock(m_musicMutex);
+			m_music.push_back(music);
+		}
+
+		void RemoveMusic(const Music& music) {
+			std::lock_guard<std::mutex> lock(m_musicMutex);
+			std::erase_if(m_music, [&](const Music& m) { return m.ctxData == music.ctxData; });
+		}
+
+		// Requires an initialized audio device
+		void Start() {
+			if (IsRunning()) return;
+
+			if (m_mixer.GetSourceCount() > 0) {
+				m_output = LoadStream(2);
+				PlayAudioStream(m_output);
+			}
+			for (auto& direct : m_streams)
+				PlayAudioStream(direct->stream);
+
+			m_running.store(true, std::memory_order_release);
+			m_thread = std::thread([this]() { ThreadMain(); });
+		}
+
+		void Stop() {
+			if (!m_running.exchange(false, std::memory_order_acq_rel)) return;
+			if (m_thread.joinable())
+				m_thread.join();
+			m_output.Unload();
+		}
+
+		bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+		AudioMixer& GetMixer() { return m_mixer; }
+		const AudioFeederConfig& GetConfig() const { return m_config; }
+
+		uint64_t GetMixerUnderruns() const { return m_mixer.GetTotalUnderruns(); }
+		uint64_t GetStreamUnderruns(size_t index) const { return m_streams.at(index)->underruns.load(std::memory_order_relaxed); }
+
+	private:
+		struct DirectStream {
+			AudioStream stream;
+			SpscRingBuffer<float> ring;
+			std::vector<float> buffer;
+			std::atomic<uint64_t> underruns{ 0 };
+			size_t frames;	// per UpdateAudioStream(), the stream's own buffer size
+
+			DirectStream(const AudioStream& s, size_t ringFrames, size_t bufferFrames)
+				: stream(s), ring(ringFrames * s.channels), buffer(bufferFrames * s.channels), frames(bufferFrames) {}
+		};
+
+		void ThreadMain() {
+			const size_t frames = m_config.framesPerBuffer;
+			while (m_running.load(std::memory_order_acquire)) {
+				{
+					std::lock_guard<std::mutex> lock(m_musicMutex);
+					for (const Music& music : m_music)
+						UpdateMusicStream(music);
+				}
+
+				if (m_output.IsLoaded()) {
+					while (IsAudioStreamProcessed(m_output)) {
+						m_mixer.Mix(m_mixBuffer.data(), frames);
+						UpdateAudioStream(m_output, m_mixBuffer.data(), static_cast<int>(frames));
+					}
+				}
+
+				for (auto& direct : m_streams) {
+					const size_t samples = direct->buffer.size();
+					while (IsAudioStreamProcessed(direct->stream)) {
+						size_t got = direct->ring.Pop(direct->buffer.data(), samples);
+						if (got < samples) {
+							direct->underruns.fetch_add(1, std::memory_order_relaxed);
+							std::fill(direct->buffer.begin() + got, direct->buffer.begin() + samples, 0.0f);
+						}
+						UpdateAudioStream(direct->stream, direct->buffer.data(), static_cast<int>(direct->frames));
+					}
+				}
+
+				std::this_thread::sleep_for(m_config.pollInterval);
+			}
+		}
+
+		AudioFeederConfig m_config;
+		AudioMixer m_mixer;
+		std::vector<float> m_mixBuffer;
+		Managed<AudioStream> m_output{};
+		std::vector<std::unique_ptr<DirectStream>> m_streams;
+
+		std::mutex m_musicMutex;
+		std::vector<Music> m_music;
+
+		std::atomic<bool> m_running{ false };
+		std::thread m_thread;
+	};
+
+	// Persistent workers for data-parallel loops. The calling thread takes part in every ParallelFor.
+	class ThreadPool {
+	public:
+		explicit ThreadPool(unsigned int workers = std::max(1u, std::thread::hardware_concurrency()) - 1) {
+			for (unsigned int i = 0; i < workers; ++i)
+				m_workers.emplace_back([this]() { WorkerMain(); });
+		}
+
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_wake.notify_all();
+			for (auto& worker : m_workers)
+				worker.join();
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		static ThreadPool& Instance() {
+			static ThreadPool instance;
+			return instance;
+		}
+
+		unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_workers.size()) + 1; }
+
+		// Calls fn(begin, end) over [0, count) in chunks of at least grain elements.
+		// Nested calls from inside a worker run inline.
+		template<typename Fn>
+		void ParallelFor(size_t count, size_t grain, Fn&& fn) {
+			if (count == 0) return;
+			grain = std::max<size_t>(grain, 1);
+			if (m_workers.empty() || count <= grain || t_insideJob) {
+				fn(size_t(0), count);
+				return;
+			}
+
+			using FnType = std::remove_reference_t<Fn>;
+			Dispatch(count, grain, [](void* ctx, size_t begin, size_t end) { (*static_cast<FnType*>(ctx))(begin, end); }, const_cast<void*>(static_cast<const void*>(&fn)));
+		}
+
+	private:
+		using JobFn = void(*)(void*, size_t, size_t);
+
+		void Dispatch(size_t count, size_t grain, JobFn invoke, void* ctx) {
+			std::lock_guard<std::mutex> submit(m_submitMutex);
+
+			size_t chunks = std::min((count + grain - 1) / grain, static_cast<size_t>(GetThreadCount()) * 4);
+			{
+				// Workers still leaving the previous job must not see the fields change under them
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_idle.wait(lock, [&]() { return m_busy == 0; });
+				m_invoke = invoke;
+				m_context = ctx;
+				m_count = count;
+				m_chunkSize = (count + chunks - 1) / chunks;
+				m_chunks = (count + m_chunkSize - 1) / m_chunkSize;
+				m_next.store(0, std::memory_order_relaxed);
+				m_done.store(0, std::memory_order_relaxed);
+				m_error = nullptr;
+				++m_generation;
+			}
+			m_wake.notify_all();
+
+			t_insideJob = true;
+			RunChunks();
+			t_insideJob = false;
+
+			while (m_done.load(std::memory_order_acquire) < m_chunks)
+				std::this_thread::yield();
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_error)
+				std::rethrow_exception(std::exchange(m_error, nullptr));
+		}
+
+		void RunChunks() {
+			size_t chunk;
+			while ((chunk = m_next.fetch_add(1, std::memory_order_relaxed)) < m_chunks) {
+				size_t begin = chunk * m_chunkSize;
+				size_t end = std::min(begin + m_chunkSize, m_count);
+				try {
+					m_invoke(m_context, begin, end);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (!m_error) m_error = std::current_exception();
+				}
+				m_done.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+		void WorkerMain() {
+			t_insideJob = true;
+			uint64_t seen = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+					if (m_stop) return;
+					seen = m_generation;
+					++m_busy;
+				}
+				RunChunks();
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					--m_busy;
+				}
+				m_idle.notify_all();
+			}
+		}
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_submitMutex;
+		std::mutex m_mutex;
+		std::condition_variable m_wake;
+		std::condition_variable m_idle;
+		unsigned int m_busy = 0;
+		bool m_stop = false;
+		uint64_t m_generation = 0;
+
+		JobFn m_invoke = nullptr;
+		void* m_context = nullptr;
+		size_t m_count = 0;
+		size_t m_chunkSize = 0;
+		size_t m_chunks = 0;
+		std::atomic<size_t> m_next{ 0 };
+		std::atomic<size_t> m_done{ 0 };
+		std::exception_ptr m_error;
+
+		inline static thread_local bool t_insideJob = false;
+	};
+
+	// View frustum as six normalized planes (a, b, c, d), inside when a*x + b*y + c*z + d >= 0
+	struct Frustum {
+		Vector4 planes[6]{};
+
+		Frustum() = default;
+
+		// viewProjection = MatrixMultiply(view, projection), as rlgl composes them
+		explicit Frustum(const Matrix& m) {
+			const float row0[4] = { m.m0, m.m4, m.m8, m.m12 };
+			const float row1[4] = { m.m1, m.m5, m.m9, m.m13 };
+			const float row2[4] = { m.m2, m.m6, m.m10, m.m14 };
+			const float row3[4] = { m.m3, m.m7, m.m11, m.m15 };
+			const float* rows[3] = { row0, row1, row2 };
+			for (int i = 0; i < 3; ++i) {
+				planes[i * 2] = Normalize(row3[0] + rows[i][0], row3[1] + rows[i][1], row3[2] + rows[i][2], row3[3] + rows[i][3]);
+				planes[i * 2 + 1] = Normalize(row3[0] - rows[i][0], row3[1] - rows[i][1], row3[2] - rows[i][2], row3[3] - rows[i][3]);
+			}
+		}
+
+		static Frustum FromCamera(const Camera3D& camera, float aspect, float nearPlane = 0.01f, float farPlane = 1000.0f) {
+			Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+			Matrix projection;
+			if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+				double top = camera.fovy / 2.0;
+				double right = top * aspect;
+				projection = MatrixOrtho(-right, right, -top, top, nearPlane, farPlane);
+			}
+			else {
+				projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, nearPlane, farPlane);
+			}
+			return Frustum(MatrixMultiply(view, projection));
+		}
+
+		bool ContainsSphere(Vector3 center, float radius) const {
+			for (const Vector4& p : planes)
+				if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius)
+					return false;
+			return true;
+		}
+
+	private:
+		static Vector4 Normalize(float a, float b, float c, float d) {
+			float len = std::sqrt(a * a + b * b + c * c);
+			if (len == 0.0f) return { a, b, c, d };
+			return { a / len, b / len, c / len, d / len };
+		}
+	};
+
+	// Many copies of a mesh drawn with DrawMeshInstanced. Bounds are kept SoA for culling,
+	// transforms as a flat Matrix array that is compacted per LOD into the draw buffers.
+	// The material's shader must support instancing.
+	class InstanceBatch {
+	public:
+		static constexpr size_t MaxLods = 8;
+		static constexpr uint8_t Culled = 0xFF;
+
+		InstanceBatch() = default;
+
+		InstanceBatch(const Mesh& mesh, const Material& material) : m_material(material) {
+			AddLod(mesh);
+		}
+
+		explicit InstanceBatch(const Model& model) {
+			if (model.meshCount < 1)
+				throw std::invalid_argument("InstanceBatch requires a model with at least one mesh.");
+			m_material = model.materials[model.meshMaterial ? model.meshMaterial[0] : 0];
+			AddLod(model.meshes[0]);
+		}
+
+		// LODs are added nearest first; each is used up to maxDistance from the camera
+		void AddLod(const Mesh& mesh, float maxDistance = std::numeric_limits<float>::infinity()) {
+			if (m_lods.size() >= MaxLods)
+				throw std::length_error("InstanceBatch LOD limit reached.");
+			if (!m_lods.empty() && maxDistance <= m_lods.back().maxDistance)
+				throw std::invalid_argument("InstanceBatch LODs must be added with increasing distance.");
+
+			if (m_lods.empty() && mesh.vertices) {
+				BoundingBox box = GetMeshBoundingBox(mesh);
+				Vector3 center = { (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+				Vector3 half = { (box.max.x - box.min.x) * 0.5f, (box.max.y - box.min.y) * 0.5f, (box.max.z - box.min.z) * 0.5f };
+				m_meshRadius = Vector3Length(center) + Vector3Length(half);
+			}
+			m_lods.push_back(Lod{ mesh, maxDistance });
+			m_visible.emplace_back();
+		}
+
+		void SetLodDistance(size_t lod, float maxDistance) {
+			if ((lod > 0 && maxDistance <= m_lods.at(lod - 1).maxDistance) ||
+				(lod + 1 < m_lods.size() && maxDistance >= m_lods[lod + 1].maxDistance))
+				throw std::invalid_argument("InstanceBatch LOD distances must be increasing.");
+			m_lods.at(lod).maxDistance = maxDistance;
+		}
+
+		size_t GetLodCount() const { return m_lods.size(); }
+
+		void SetMaterial(const Material& material) { m_material = material; }
+		void SetMeshRadius(float radius) { m_meshRadius = radius; }
+
+		// --- Instances ---
+		void Reserve(size_t count) {
+			m_transforms.reserve(count);
+			m_x.reserve(count);
+			m_y.reserve(count);
+			m_z.reserve(count);
+			m_radius.reserve(count);
+			m_lodOf.reserve(count);
+		}
+
+		// Bounding radius defaults to the LOD 0 mesh radius scaled by the transform
+		size_t Add(const Matrix& transform, float radius = -1.0f) {
+			m_transforms.push_back(transform);
+			m_x.push_back(0.0f);
+			m_y.push_back(0.0f);
+			m_z.push_back(0.0f);
+			m_radius.push_back(0.0f);
+			m_lodOf.push_back(Culled);
+			Set(m_transforms.size() - 1, transform, radius);
+			return m_transforms.size() - 1;
+		}
+
+		void Set(size_t index, const Matrix& transform, float radius = -1.0f) {
+			m_transforms.at(index) = transform;
+			m_x[index] = transform.m12;
+			m_y[index] = transform.m13;
+			m_z[index] = transform.m14;
+			m_radius[index] = radius >= 0.0f ? radius : m_meshRadius * MaxScale(transform);
+		}
+
+		// Swap-remove, moves the last instance into index
+		void Remove(size_t index) {
+			size_t last = m_transforms.size() - 1;
+			if (index > last) throw std::out_of_range("InstanceBatch index out of range.");
+			m_transforms[index] = m_transforms[last];
+			m_x[index] = m_x[last];
+			m_y[index] = m_y[last];
+			m_z[index] = m_z[last];
+			m_radius[index] = m_radius[last];
+			m_lodOf[index] = m_lodOf[last];
+			m_transforms.pop_back();
+			m_x.pop_back();
+			m_y.pop_back();
+			m_z.pop_back();
+			m_radius.pop_back();
+			m_lodOf.pop_back();
+		}
+
+		void Clear() {
+			m_transforms.clear();
+			m_x.clear();
+			m_y.clear();
+			m_z.clear();
+			m_radius.clear();
+			m_lodOf.clear();
+			for (auto& visible : m_visible) visible.clear();
+		}
+
+		size_t Size() const { return m_transforms.size(); }
+		const Matrix& GetTransform(size_t index) const { return m_transforms.at(index); }
+
+		// --- Culling ---
+		void Cull(const Camera3D& camera, float aspect, float nearPlane = 0.01f, float farPlane = 1000.0f) {
+			Cull(Frustum::FromCamera(camera, aspect, nearPlane, farPlane), camera.position);
+		}
+
+		// Frustum + distance cull and LOD select, then compact visible transforms per LOD. CPU only.
+		void Cull(const Frustum& frustum, Vector3 eye, ThreadPool& pool = ThreadPool::Instance()) {
+			const size_t count = m_transforms.size();
+			const size_t lods = std::max<size_t>(m_lods.size(), 1);
+			const size_t chunks = (count + ChunkSize - 1) / ChunkSize;
+			m_chunkCounts.assign(chunks * lods, 0);
+
+			float lodDistSq[MaxLods];
+			for (size_t l = 0; l < lods; ++l) {
+				float d = l < m_lods.size() ? std::min(m_lods[l].maxDistance, m_maxDistance) : m_maxDistance;
+				lodDistSq[l] = std::isinf(d) ? std::numeric_limits<float>::infinity() : d * d;
+			}
+
+			// Stage 1: classify each instance (LOD index or Culled) and count per chunk
+			pool.ParallelFor(chunks, 1, [&](size_t firstChunk, size_t lastChunk) {
+				for (size_t c = firstChunk; c < lastChunk; ++c) {
+					size_t begin = c * ChunkSize;
+					size_t end = std::min(begin + ChunkSize, count);
+					Classify(frustum, eye, lodDistSq, lods, begin, end);
+					uint32_t* counts = m_chunkCounts.data() + c * lods;
+					for (size_t i = begin; i < end; ++i)
+						if (m_lodOf[i] != Culled) ++counts[m_lodOf[i]];
+				}
+			});
+
+			// Stage 2: exclusive prefix sums give every chunk its output offset per LOD
+			m_visible.resize(lods);
+			for (size_t l = 0; l < lods; ++l) {
+				uint32_t total = 0;
+				for (size_t c = 0; c < chunks; ++c) {
+					uint32_t n = m_chunkCounts[c * lods + l];
+					m_chunkCounts[c * lods + l] = total;
+					total += n;
+				}
+				m_visible[l].resize(total);
+			}
+
+			// Stage 3: compact
+			pool.ParallelFor(chunks, 1, [&](size_t firstChunk, size_t lastChunk) {
+				size_t offsets[MaxLods];
+				for (size_t c = firstChunk; c < lastChunk; ++c) {
+					for (size_t l = 0; l < lods; ++l) offsets[l] = m_chunkCounts[c * lods + l];
+					size_t begin = c * ChunkSize;
+					size_t end = std::min(begin + ChunkSize, count);
+					for (size_t i = begin; i < end; ++i) {
+						uint8_t lod = m_lodOf[i];
+						if (lod != Culled)
+							m_visible[lod][offsets[lod]++] = m_transforms[i];
+					}
+				}
+			});
+		}
+
+		// Instances past this distance are culled regardless of LOD ranges
+		void SetCullDistance(float distance) { m_maxDistance = distance; }
+
+		size_t GetVisibleCount() const {
+			size_t total = 0;
+			for (const auto& visible : m_visible) total += visible.size();
+			return total;
+		}
+
+		size_t GetVisibleCount(size_t lod) const { return m_visible.at(lod).size(); }
+		const std::vector<Matrix>& GetVisible(size_t lod) const { return m_visible.at(lod); }
+		uint8_t GetLod(size_t index) const { return m_lodOf.at(index); }
+
+		// --- Rendering ---
+		void Draw() const {
+			for (size_t l = 0; l < m_lods.size(); ++l)
+				if (!m_visible[l].empty())
+					DrawMeshInstanced(m_lods[l].mesh, m_material, m_visible[l].data(), static_cast<int>(m_visible[l].size()));
+		}
+
+	private:
+		struct Lod {
+			Mesh mesh{};
+			float maxDistance = std::numeric_limits<float>::infinity();
+		};
+
+		static constexpr size_t ChunkSize = 16384;
+
+		static float MaxScale(const Matrix& m) {
+			float sx = m.m0 * m.m0 + m.m1 * m.m1 + m.m2 * m.m2;
+			float sy = m.m4 * m.m4 + m.m5 * m.m5 + m.m6 * m.m6;
+			float sz = m.m8 * m.m8 + m.m9 * m.m9 + m.m10 * m.m10;
+			return std::sqrt(std::max(sx, std::max(sy, sz)));
+		}
+
+		void Classify(const Frustum& frustum, Vector3 eye, const float* lodDistSq, size_t lods, size_t begin, size_t end) {
+			size_t i = begin;
+#ifdef RLX_SSE2
+			const __m128 ex = _mm_set1_ps(eye.x);
+			const __m128 ey = _mm_set1_ps(eye.y);
+			const __m128 ez = _mm_set1_ps(eye.z);
+			for (; i + 4 <= end; i += 4) {
+				__m128 x = _mm_loadu_ps(m_x.data() + i);
+				__m128 y = _mm_loadu_ps(m_y.data() + i);
+				__m128 z = _mm_loadu_ps(m_z.data() + i);
+				__m128 r = _mm_loadu_ps(m_radius.data() + i);
+				__m128 negR = _mm_sub_ps(_mm_setzero_ps(), r);
+
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (const Vector4& p : frustum.planes) {
+					__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(p.x)), _mm_mul_ps(y, _mm_set1_ps(p.y))),
+						_mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(p.z)), _mm_set1_ps(p.w)));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(d, negR));
+				}
+
+				__m128 dx = _mm_sub_ps(x, ex);
+				__m128 dy = _mm_sub_ps(y, ey);
+				__m128 dz = _mm_sub_ps(z, ez);
+				__m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+				// LOD = number of ranges the instance lies beyond; == lods means out of range
+				__m128i lod = _mm_setzero_si128();
+				for (size_t l = 0; l < lods; ++l)
+					lod = _mm_sub_epi32(lod, _mm_castps_si128(_mm_cmpgt_ps(distSq, _mm_set1_ps(lodDistSq[l]))));
+
+				alignas(16) int32_t lodOut[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(lodOut), lod);
+				int mask = _mm_movemask_ps(inside);
+				for (int k = 0; k < 4; ++k)
+					m_lodOf[i + k] = ((mask >> k) & 1) && static_cast<size_t>(lodOut[k]) < lods ? static_cast<uint8_t>(lodOut[k]) : Culled;
+			}
+#endif
+			for (; i < end; ++i) {
+				Vector3 center = { m_x[i], m_y[i], m_z[i] };
+				if (!frustum.ContainsSphere(center, m_radius[i])) {
+					m_lodOf[i] = Culled;
+					continue;
+				}
+				float dx = center.x - eye.x;
+				float dy = center.y - eye.y;
+				float dz = center.z - eye.z;
+				float distSq = dx * dx + dy * dy + dz * dz;
+				size_t lod = 0;
+				while (lod < lods && distSq > lodDistSq[lod]) ++lod;
+				m_lodOf[i] = lod < lods ? static_cast<uint8_t>(lod) : Culled;
+			}
+		}
+
+		std::vector<Lod> m_lods;
+		Material m_material{};
+		float m_meshRadius = 1.0f;
+		float m_maxDistance = std::numeric_limits<float>::infinity();
+
+		std::vector<Matrix> m_transforms;
+		std::vector<float> m_x;
+		std::vector<float> m_y;
+		std::vector<float> m_z;
+		std::vector<float> m_radius;
+
+		std::vector<uint8_t> m_lodOf;
+		std::vector<uint32_t> m_chunkCounts;
+		std::vector<std::vector<Matrix>> m_visible;
+	};
+
+	// Bytes per pixel of an uncompressed raylib pixel format, 0 for compressed formats
+	inline int GetPixelFormatSize(int format) {
+		switch (format) {
+		case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return 1;
+		case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+		case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+		case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+		case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+		case PIXELFORMAT_UNCOMPRESSED_R16: return 2;
+		case PIXELFORMAT_UNCOMPRESSED_R8G8B8: return 3;
+		case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+		case PIXELFORMAT_UNCOMPRESSED_R32: return 4;
+		case PIXELFORMAT_UNCOMPRESSED_R16G16B16: return 6;
+		case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: return 8;
+		case PIXELFORMAT_UNCOMPRESSED_R32G32B32: return 12;
+		case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return 16;
+		default: return 0;
+		}
+	}
+
+	// Non-owning window into the base level of an uncompressed image: the region's first pixel, the
+	// source row stride in bytes, the region within the source and its pixel format. Views never copy
+	// and must not outlive the pixels they point at.
+	// ImageView (Byte = uint8_t) can write and is only made from mutable images; ConstImageView
+	// (Byte = const uint8_t) is what const images and shared pixels hand out. Writable views convert to read-only ones.
+	template<typename Byte>
+	class BasicImageView {
+		static constexpr bool ReadOnly = std::is_const_v<Byte>;
+		using ImageRef = std::conditional_t<ReadOnly, const Image&, Image&>;
+		using ManagedRef = std::conditional_t<ReadOnly, const Managed<Image>&, Managed<Image>&>;
+		using Pointer = std::conditional_t<ReadOnly, const void*, void*>;
+
+	public:
+		BasicImageView() = default;
+
+		BasicImageView(ImageRef image)
+			: BasicImageView(image, Rectangle<int>{ 0, 0, image.width, image.height }) {
+		}
+
+		BasicImageView(ImageRef image, Rectangle<int> region) {
+			const int bpp = GetPixelFormatSize(image.format);
+			if (!image.data || bpp == 0)
+				throw std::invalid_argument("ImageView requires a loaded, uncompressed image.");
+			CheckRegion(region, image.width, image.height);
+			m_stride = static_cast<size_t>(image.width) * bpp;
+			m_data = static_cast<Byte*>(image.data) + region.y * m_stride + static_cast<size_t>(region.x) * bpp;
+			m_region = region;
+			m_format = image.format;
+			m_bpp = bpp;
+		}
+
+		BasicImageView(ManagedRef image) : BasicImageView(*image) {}
+		BasicImageView(ManagedRef image, Rectangle<int> region) : BasicImageView(*image, region) {}
+
+		// Wraps external pixels, e.g. a mapped file or a staging buffer
+		BasicImageView(Pointer data, int width, int height, size_t stride, int format)
+			: m_data(static_cast<Byte*>(data)), m_stride(stride), m_region{ 0, 0, width, height },
+			  m_format(format), m_bpp(GetPixelFormatSize(format))
+		{
+			if (!data || m_bpp == 0 || width < 0 || height < 0 || stride < static_cast<size_t>(width) * m_bpp)
+				throw std::invalid_argument("ImageView requires uncompressed pixels and a stride of at least one row.");
+		}
+
+		template<typename Other>
+			requires ReadOnly && std::same_as<Other, uint8_t>
+		BasicImageView(const BasicImageView<Other>& other)
+			: m_data(other.m_data), m_stride(other.m_stride), m_region(other.m_region), m_format(other.m_format), m_bpp(other.m_bpp) {
+		}
+
+		Byte* Data() const { return m_data; }
+		Byte* Row(int y) const { return m_data + static_cast<size_t>(y) * m_stride; }
+		Byte* Pixel(int x, int y) const { return Row(y) + static_cast<size_t>(x) * m_bpp; }
+
+		size_t GetStride() const { return m_stride; }
+		size_t GetRowBytes() const { return static_cast<size_t>(m_region.width) * m_bpp; }
+		int GetWidth() const { return m_region.width; }
+		int GetHeight() const { return m_region.height; }
+		int GetFormat() const { return m_format; }
+		int GetBytesPerPixel() const { return m_bpp; }
+		// Position within the image the view was made from
+		Rectangle<int> GetRegion() const { return m_region; }
+
+		bool IsEmpty() const { return !m_data || m_region.width <= 0 || m_region.height <= 0; }
+		// True when rows are back to back, so the pixels can be passed on as one block
+		bool IsContiguous() const { return m_region.height <= 1 || m_stride == GetRowBytes(); }
+
+		// Region relative to this view
+		BasicImageView Sub(Rectangle<int> region) const {
+			CheckRegion(region, m_region.width, m_region.height);
+			BasicImageView view = *this;
+			view.m_data = Pixel(region.x, region.y);
+			view.m_region = Rectangle<int>{ m_region.x + region.x, m_region.y + region.y, region.width, region.height };
+			return view;
+		}
+
+		// Row-major cells of a sprite sheet, skipping margin around the sheet and spacing between cells.
+		// Partial cells at the right and bottom edges are left out.
+		std::vector<BasicImageView> Slice(int cellWidth, int cellHeight, int spacing = 0, int margin = 0) const {
+			if (cellWidth <= 0 || cellHeight <= 0 || spacing < 0 || margin < 0)
+				throw std::invalid_argument("ImageView::Slice requires a positive cell size.");
+			std::vector<BasicImageView> cells;
+			const int columns = std::max(0, (m_region.width - 2 * margin + spacing) / (cellWidth + spacing));
+			const int rows = std::max(0, (m_region.height - 2 * margin + spacing) / (cellHeight + spacing));
+			cells.reserve(static_cast<size_t>(columns) * rows);
+			for (int row = 0; row < rows; ++row)
+				for (int col = 0; col < columns; ++col)
+					cells.push_back(Sub({ margin + col * (cellWidth + spacing), margin + row * (cellHeight + spacing), cellWidth, cellHeight }));
+			return cells;
+		}
+
+		// Copies the rows into dst, which holds at least GetHeight() rows of dstStride bytes
+		void CopyTo(void* dst, size_t dstStride) const {
+			uint8_t* out = static_cast<uint8_t*>(dst);
+			const size_t rowBytes = GetRowBytes();
+			if (IsContiguous() && dstStride == rowBytes) {
+				std::memcpy(out, m_data, rowBytes * m_region.height);
+				return;
+			}
+			for (int y = 0; y < m_region.height; ++y)
+				std::memcpy(out + y * dstStride, Row(y), rowBytes);
+		}
+
+		void CopyFrom(const BasicImageView<const uint8_t>& src) requires (!ReadOnly) {
+			if (src.m_region.width != m_region.width || src.m_region.height != m_region.height || src.m_format != m_format)
+				throw std::invalid_argument("ImageView::CopyFrom requires views of the same size and format.");
+			for (int y = 0; y < m_region.height; ++y)
+				std::memmove(Row(y), src.Row(y), GetRowBytes());
+		}
+
+		// Tightly packed copy as a standalone image; the only copying conversion
+		Managed<Image> ToImage() const {
+			Image image{};
+			if (IsEmpty())
+				return Managed<Image>(image);
+			image.data = MemAlloc(static_cast<unsigned int>(GetRowBytes() * m_region.height));
+			image.width = m_region.width;
+			image.height = m_region.height;
+			image.mipmaps = 1;
+			image.format = m_format;
+			CopyTo(image.data, GetRowBytes());
+			return Managed<Image>(image);
+		}
+
+	private:
+		template<typename> friend class BasicImageView;
+
+		static void CheckRegion(const Rectangle<int>& r, int width, int height) {
+			if (r.x < 0 || r.y < 0 || r.width < 0 || r.height < 0 || r.x > width - r.width || r.y > height - r.height)
+				throw std::out_of_range("ImageView region lies outside the image.");
+		}
+
+		Byte* m_data = nullptr;
+		size_t m_stride = 0;
+		Rectangle<int> m_region{};
+		int m_format = 0;
+		int m_bpp = 0;
+	};
+
+	using ImageView = BasicImageView<uint8_t>;
+	using ConstImageView = BasicImageView<const uint8_t>;
+
+	// Writes a view into a texture region at (x, y). Contiguous views go straight to the driver; strided
+	// ones are packed row by row into scratch first, which callers uploading often can keep alive.
+	inline void UpdateTextureRegion(const Texture2D& texture, int x, int y, const ConstImageView& view, std::vector<uint8_t>* scratch = nullptr) {
+		if (view.GetFormat() != texture.format)
+			throw std::invalid_argument("UpdateTextureRegion requires the view and texture to share a pixel format.");
+		if (x < 0 || y < 0 || x > texture.width - view.GetWidth() || y > texture.height - view.GetHeight())
+			throw std::out_of_range("UpdateTextureRegion target lies outside the texture.");
+		if (view.IsEmpty())
+			return;
+
+		const rlRectangle rect{ (float)x, (float)y, (float)view.GetWidth(), (float)view.GetHeight() };
+		if (view.IsContiguous()) {
+			UpdateTextureRec(texture, rect, view.Data());
+			return;
+		}
+		std::vector<uint8_t> local;
+		std::vector<uint8_t>& packed = scratch ? *scratch : local;
+		packed.resize(view.GetRowBytes() * view.GetHeight());
+		view.CopyTo(packed.data(), view.GetRowBytes());
+		UpdateTextureRec(texture, rect, packed.data());
+	}
+
+	// New texture with the view's pixels; only strided views need a temporary packed copy
+	inline Managed<Texture2D> LoadTextureFromView(const ConstImageView& view) {
+		if (view.IsEmpty())
+			throw std::invalid_argument("LoadTextureFromView requires a non-empty view.");
+		if (view.IsContiguous()) {
+			// LoadTextureFromImage only reads the pixels; Image just has no const form
+			Image image{ const_cast<uint8_t*>(view.Data()), view.GetWidth(), view.GetHeight(), 1, view.GetFormat() };
+			return Managed<Texture2D>(LoadTextureFromImage(image));
+		}
+		Managed<Image> packed = view.ToImage();
+		return Managed<Texture2D>(LoadTextureFromImage(*packed));
+	}
+
+	// Reference-counted image with copy-on-write: copies share one pixel buffer until one of them asks for
+	// write access, which gives it a private copy first. The count is atomic, but a SharedImage object
+	// itself must not be written from two threads at once.
+	class SharedImage {
+	public:
+		SharedImage() = default;
+
+		// Takes ownership without copying
+		explicit SharedImage(Managed<Image>&& image)
+			: m_image(image.IsLoaded() ? std::make_shared<Managed<Image>>(std::move(image)) : nullptr) {
+		}
+
+		// Packed copy of the view's pixels
+		explicit SharedImage(const ConstImageView& view)
+			: SharedImage(view.ToImage()) {
+		}
+
+		bool IsLoaded() const { return m_image != nullptr; }
+		long GetUseCount() const { return m_image.use_count(); }
+		bool IsShared() const { return m_image.use_count() > 1; }
+
+		int GetWidth() const { return m_image ? (*m_image)->width : 0; }
+		int GetHeight() const { return m_image ? (*m_image)->height : 0; }
+		int GetFormat() const { return m_image ? (*m_image)->format : 0; }
+
+		// Read-only access; the pixels may be shared with other SharedImages
+		const Image& Get() const {
+			if (!m_image)
+				throw std::logic_error("SharedImage is empty.");
+			return **m_image;
+		}
+
+		ConstImageView View() const { return ConstImageView(Get()); }
+		ConstImageView View(Rectangle<int> region) const { return ConstImageView(Get(), region); }
+
+		// Write access; copies the pixels first when they are shared
+		Image& Mutable() {
+			if (!m_image)
+				throw std::logic_error("SharedImage is empty.");
+			if (m_image.use_count() > 1)
+				m_image = std::make_shared<Managed<Image>>(ImageCopy(**m_image));
+			return **m_image;
+		}
+
+		ImageView MutableView() { return ImageView(Mutable()); }
+		ImageView MutableView(Rectangle<int> region) { return ImageView(Mutable(), region); }
+
+		// Gives up this reference, moving the image out when it is the last one and copying otherwise
+		Managed<Image> Release() {
+			if (!m_image)
+				return Managed<Image>();
+			Managed<Image> out = m_image.use_count() == 1 ? std::move(*m_image) : Managed<Image>(ImageCopy(**m_image));
+			m_image.reset();
+			return out;
+		}
+
+	private:
+		std::shared_ptr<Managed<Image>> m_image;
+	};
+
+	// Chains image operations over R8G8B8A8 pixels. Consecutive per-pixel stages are fused into one
+	// colour matrix and run in the same tile pass as the neighbourhood stage before them, unless the earlier
+	// one can leave [0, 255] and would need its clamp (e.g. Brightness); every pass is split into row or
+	// column tiles across the ThreadPool.
+	class ImagePipeline {
+	public:
+		// --- Per-pixel stages (fused) ---
+		ImagePipeline& Tint(Color color) {
+			PointOp op;
+			op.m[0] = color.r / 255.0f;
+			op.m[5] = color.g / 255.0f;
+			op.m[10] = color.b / 255.0f;
+			op.m[15] = color.a / 255.0f;
+			return AddPoint(op);
+		}
+
+		ImagePipeline& Grayscale() {
+			PointOp op;
+			for (int row = 0; row < 3; ++row) {
+				op.m[row * 4 + 0] = 0.299f;
+				op.m[row * 4 + 1] = 0.587f;
+				op.m[row * 4 + 2] = 0.114f;
+				op.m[row * 4 + 3] = 0.0f;
+			}
+			return AddPoint(op);
+		}
+
+		ImagePipeline& Invert() {
+			PointOp op;
+			for (int c = 0; c < 3; ++c) {
+				op.m[c * 5] = -1.0f;
+				op.offset[c] = 255.0f;
+			}
+			return AddPoint(op);
+		}
+
+		// -255 to 255, like ImageColorBrightness
+		ImagePipeline& Brightness(int amount) {
+			PointOp op;
+			float value = static_cast<float>(std::clamp(amount, -255, 255));
+			op.offset[0] = op.offset[1] = op.offset[2] = value;
+			return AddPoint(op);
+		}
+
+		// -100 to 100, like ImageColorContrast
+		ImagePipeline& Contrast(float contrast) {
+			PointOp op;
+			float factor = (100.0f + std::clamp(contrast, -100.0f, 100.0f)) / 100.0f;
+			factor *= factor;
+			for (int c = 0; c < 3; ++c) {
+				op.m[c * 5] = factor;
+				op.offset[c] = 127.5f * (1.0f - factor);
+			}
+			return AddPoint(op);
+		}
+
+		// Row-major 4x4 matrix followed by a 0-255 offset per channel
+		ImagePipeline& ColorMatrix(const float (&matrix)[16], const float (&offset)[4]) {
+			PointOp op;
+			std::copy(std::begin(matrix), std::end(matrix), op.m);
+			std::copy(std::begin(offset), std::end(offset), op.offset);
+			return AddPoint(op);
+		}
+
+		ImagePipeline& Premultiply() {
+			if (m_stages.empty() || !m_stages.back().hasPoint || m_stages.back().point.premultiply)
+				AddPoint(PointOp{});
+			m_stages.back().point.premultiply = true;
+			return *this;
+		}
+
+		// --- Neighbourhood stages ---
+		ImagePipeline& Blur(int radius) {
+			if (radius > 0) AddStage(StageKind::Blur, radius, 0);
+			return *this;
+		}
+
+		ImagePipeline& Resize(int width, int height) {
+			if (width <= 0 || height <= 0)
+				throw std::invalid_argument("ImagePipeline::Resize requires a positive size.");
+			return AddStage(StageKind::Resize, width, height);
+		}
+
+		// Full 2x2 box-filtered chain in raylib's layout; only Format() may follow
+		ImagePipeline& Mipmaps() { return AddStage(StageKind::Mipmaps, 0, 0); }
+
+		// Final pixel format; must be the last stage
+		ImagePipeline& Format(int pixelFormat) { return AddStage(StageKind::Format, pixelFormat, 0); }
+
+		void Clear() { m_stages.clear(); }
+
+		// Number of passes over the image after fusion
+		size_t GetPassCount() const { return m_stages.size(); }
+
+		// Runs every stage in place
+		void Apply(Image& image, ThreadPool& pool = ThreadPool::Instance()) const {
+			if (!image.data || image.width <= 0 || image.height <= 0)
+				throw std::invalid_argument("ImagePipeline::Apply requires a loaded image.");
+			if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+				ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+			image.mipmaps = 1;	// stages work on the base level
+
+			for (const Stage& stage : m_stages) {
+				switch (stage.kind) {
+				case StageKind::Point:
+					RunPoint(image, stage.point, pool);
+					break;
+				case StageKind::Blur:
+					RunBlur(image, stage.a, stage.hasPoint ? &stage.point : nullptr, pool);
+					break;
+				case StageKind::Resize:
+					RunResize(image, stage.a, stage.b, stage.hasPoint ? &stage.point : nullptr, pool);
+					break;
+				case StageKind::Mipmaps:
+					RunMipmaps(image, pool);
+					break;
+				case StageKind::Format:
+					RunFormat(image, stage.a, pool);
+					break;
+				}
+			}
+		}
+
+		void Apply(Managed<Image>& image, ThreadPool& pool = ThreadPool::Instance()) const { Apply(*image, pool); }
+
+		// Runs the stages in place on a region of a larger image, e.g. one cell of an atlas. Views cannot
+		// change size or format, so only per-pixel and blur stages are allowed; blur clamps at the view's edges.
+		// The view must be writable; shared pixels give one through SharedImage::MutableView().
+		void Apply(const ImageView& view, ThreadPool& pool = ThreadPool::Instance()) const {
+			if (view.GetFormat() != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+				throw std::invalid_argument("ImagePipeline::Apply on a view requires R8G8B8A8 pixels.");
+			for (const Stage& stage : m_stages)
+				if (stage.kind != StageKind::Point && stage.kind != StageKind::Blur)
+					throw std::logic_error("ImagePipeline::Apply on a view supports per-pixel and blur stages only.");
+			if (view.IsEmpty())
+				return;
+
+			for (const Stage& stage : m_stages) {
+				if (stage.kind == StageKind::Point)
+					RunPoint(view.Data(), view.GetWidth(), view.GetHeight(), view.GetStride(), stage.point, pool);
+				else
+					RunBlur(view.Data(), view.GetWidth(), view.GetHeight(), view.GetStride(), stage.a, stage.hasPoint ? &stage.point : nullptr, pool);
+			}
+		}
+
+		// Point-stage kernel on a run of R8G8B8A8 pixels
+		struct PointOp {
+			float m[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+			float offset[4] = { 0, 0, 0, 0 };
+			bool premultiply = false;
+
+			// True when no input in [0, 255] can map outside it, so the clamp after this op never applies and it
+			// can be fused with the next one without changing the result
+			bool StaysInRange() const {
+				for (int r = 0; r < 4; ++r) {
+					float lo = offset[r];
+					float hi = offset[r];
+					for (int k = 0; k < 4; ++k) {
+						lo += std::min(0.0f, m[r * 4 + k]) * 255.0f;
+						hi += std::max(0.0f, m[r * 4 + k]) * 255.0f;
+					}
+					if (lo < -0.001f || hi > 255.001f)
+						return false;
+				}
+				return true;
+			}
+
+			// Returns the op equal to applying this, then next, as long as this StaysInRange()
+			PointOp Then(const PointOp& next) const {
+				PointOp out;
+				for (int r = 0; r < 4; ++r) {
+					for (int c = 0; c < 4; ++c) {
+						float sum = 0.0f;
+						for (int k = 0; k < 4; ++k)
+							sum += next.m[r * 4 + k] * m[k * 4 + c];
+						out.m[r * 4 + c] = sum;
+					}
+					float off = next.offset[r];
+					for (int k = 0; k < 4; ++k)
+						off += next.m[r * 4 + k] * offset[k];
+					out.offset[r] = off;
+				}
+				out.premultiply = next.premultiply;
+				return out;
+			}
+
+			void Apply(uint8_t* pixels, size_t count) const {
+				size_t i = 0;
+#ifdef RLX_SSE2
+				const __m128 c0 = _mm_setr_ps(m[0], m[4], m[8], m[12]);
+				const __m128 c1 = _mm_setr_ps(m[1], m[5], m[9], m[13]);
+				const __m128 c2 = _mm_setr_ps(m[2], m[6], m[10], m[14]);
+				const __m128 c3 = _mm_setr_ps(m[3], m[7], m[11], m[15]);
+				const __m128 off = _mm_loadu_ps(offset);
+				const __m128 lo = _mm_setzero_ps();
+				const __m128 hi = _mm_set1_ps(255.0f);
+				const __m128 inv255 = _mm_set1_ps(1.0f / 255.0f);
+				const __m128 rgbMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+				const __m128 alphaOne = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+				const __m128i zero = _mm_setzero_si128();
+				for (; i < count; ++i) {
+					uint8_t* px = pixels + i * 4;
+					int32_t packed;
+					std::memcpy(&packed, px, 4);
+					__m128i wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+					__m128 p = _mm_cvtepi32_ps(wide);
+					__m128 o = _mm_add_ps(off, _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(p, p, 0x00)), _mm_mul_ps(c1, _mm_shuffle_ps(p, p, 0x55))),
+						_mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(p, p, 0xAA)), _mm_mul_ps(c3, _mm_shuffle_ps(p, p, 0xFF)))));
+					o = _mm_min_ps(_mm_max_ps(o, lo), hi);
+					if (premultiply) {
+						__m128 a = _mm_mul_ps(_mm_shuffle_ps(o, o, 0xFF), inv255);
+						o = _mm_mul_ps(o, _mm_or_ps(_mm_and_ps(a, rgbMask), alphaOne));
+					}
+					__m128i q = _mm_cvtps_epi32(o);
+					q = _mm_packus_epi16(_mm_packs_epi32(q, q), zero);
+					packed = _mm_cvtsi128_si32(q);
+					std::memcpy(px, &packed, 4);
+				}
+#endif
+				for (; i < count; ++i) {
+					uint8_t* px = pixels + i * 4;
+					float in[4] = { (float)px[0], (float)px[1], (float)px[2], (float)px[3] };
+					float out[4];
+					for (int r = 0; r < 4; ++r)
+						out[r] = std::clamp(offset[r] + m[r * 4] * in[0] + m[r * 4 + 1] * in[1] + m[r * 4 + 2] * in[2] + m[r * 4 + 3] * in[3], 0.0f, 255.0f);
+					if (premultiply) {
+						float a = out[3] / 255.0f;
+						out[0] *= a;
+						out[1] *= a;
+						out[2] *= a;
+					}
+					for (int c = 0; c < 4; ++c)
+						px[c] = static_cast<uint8_t>(std::lround(out[c]));
+				}
+			}
+		};
+
+	private:
+		enum class StageKind : uint8_t {
+			Point,
+			Blur,
+			Resize,
+			Mipmaps,
+			Format
+		};
+
+		struct Stage {
+			StageKind kind = StageKind::Point;
+			int a = 0;
+			int b = 0;
+			bool hasPoint = false;	// per-pixel op run on each finished tile of this stage
+			PointOp point{};
+		};
+
+		static constexpr size_t TileBytes = 64 * 1024;
+
+		void CheckAppend(StageKind kind) const {
+			if (m_stages.empty()) return;
+			StageKind last = m_stages.back().kind;
+			if (last == StageKind::Format)
+				throw std::logic_error("ImagePipeline::Format must be the last stage.");
+			if (last == StageKind::Mipmaps && kind != StageKind::Format)
+				throw std::logic_error("Only ImagePipeline::Format may follow Mipmaps.");
+		}
+
+		ImagePipeline& AddStage(StageKind kind, int a, int b) {
+			CheckAppend(kind);
+			m_stages.push_back(Stage{ kind, a, b });
+			return *this;
+		}
+
+		ImagePipeline& AddPoint(const PointOp& op) {
+			CheckAppend(StageKind::Point);
+			if (!m_stages.empty()) {
+				Stage& last = m_stages.back();
+				bool fusable = last.kind == StageKind::Point || last.kind == StageKind::Blur || last.kind == StageKind::Resize;
+				if (fusable && !(last.hasPoint && (last.point.premultiply || !last.point.StaysInRange()))) {
+					last.point = last.hasPoint ? last.point.Then(op) : op;
+					last.hasPoint = true;
+					return *this;
+				}
+			}
+			Stage stage{ StageKind::Point };
+			stage.hasPoint = true;
+			stage.point = op;
+			m_stages.push_back(stage);
+			return *this;
+		}
+
+		static size_t RowsPerTile(int width) {
+			return std::max<size_t>(1, TileBytes / (static_cast<size_t>(width) * 4));
+		}
+
+		static void Replace(Image& image, void* data, int width, int height) {
+			MemFree(image.data);
+			image.data = data;
+			image.width = width;
+			image.height = height;
+		}
+
+		static void RunPoint(Image& image, const PointOp& op, ThreadPool& pool) {
+			RunPoint(static_cast<uint8_t*>(image.data), image.width, image.height, static_cast<size_t>(image.width) * 4, op, pool);
+		}
+
+		static void RunPoint(uint8_t* pixels, int w, int h, size_t stride, const PointOp& op, ThreadPool& pool) {
+			const size_t width = static_cast<size_t>(w);
+			const bool packed = stride == width * 4;
+			pool.ParallelFor(static_cast<size_t>(h), RowsPerTile(w), [&](size_t y0, size_t y1) {
+				if (packed) {
+					op.Apply(pixels + y0 * stride, (y1 - y0) * width);
+					return;
+				}
+				for (size_t y = y0; y < y1; ++y)
+					op.Apply(pixels + y * stride, width);
+			});
+		}
+
+		// Separable box blur with clamped edges: vertical pass by column band into a scratch copy,
+		// horizontal pass by row back into the image, followed by the fused point op
+		static void RunBlur(Image& image, int radius, const PointOp* op, ThreadPool& pool) {
+			RunBlur(static_cast<uint8_t*>(image.data), image.width, image.height, static_cast<size_t>(image.width) * 4, radius, op, pool);
+		}
+
+		static void RunBlur(uint8_t* pixels, int w, int h, size_t stride, int radius, const PointOp* op, ThreadPool& pool) {
+			const size_t rowBytes = static_cast<size_t>(w) * 4;
+			std::vector<uint8_t> scratch(rowBytes * h);
+			const float inv = 1.0f / static_cast<float>(radius * 2 + 1);
+
+			constexpr size_t BandWidth = 64;
+			const size_t bands = (static_cast<size_t>(w) + BandWidth - 1) / BandWidth;
+			pool.ParallelFor(bands, 1, [&](size_t b0, size_t b1) {
+				int32_t sums[BandWidth * 4];
+				for (size_t band = b0; band < b1; ++band) {
+					const size_t x0 = band * BandWidth;
+					const size_t n = std::min(BandWidth, static_cast<size_t>(w) - x0) * 4;
+					std::fill(sums, sums + n, 0);
+					for (int k = -radius; k <= radius; ++k) {
+						const uint8_t* row = pixels + std::clamp(k, 0, h - 1) * stride + x0 * 4;
+						for (size_t c = 0; c < n; ++c) sums[c] += row[c];
+					}
+					for (int y = 0; y < h; ++y) {
+						uint8_t* out = scratch.data() + y * rowBytes + x0 * 4;
+						for (size_t c = 0; c < n; ++c)
+							out[c] = static_cast<uint8_t>(sums[c] * inv + 0.5f);
+						const uint8_t* add = pixels + std::min(y + radius + 1, h - 1) * stride + x0 * 4;
+						const uint8_t* sub = pixels + std::max(y - radius, 0) * stride + x0 * 4;
+						for (size_t c = 0; c < n; ++c) sums[c] += add[c] - sub[c];
+					}
+				}
+			});
+
+			pool.ParallelFor(static_cast<size_t>(h), RowsPerTile(w), [&](size_t y0, size_t y1) {
+				for (size_t y = y0; y < y1; ++y) {
+					const uint8_t* in = scratch.data() + y * rowBytes;
+					uint8_t* out = pixels + y * stride;
+					int32_t sum[4] = { 0, 0, 0, 0 };
+					for (int k = -radius; k <= radius; ++k) {
+						const uint8_t* px = in + std::clamp(k, 0, w - 1) * 4;
+						for (int c = 0; c < 4; ++c) sum[c] += px[c];
+					}
+					for (int x = 0; x < w; ++x) {
+						const uint8_t* add = in + std::min(x + radius + 1, w - 1) * 4;
+						const uint8_t* sub = in + std::max(x - radius, 0) * 4;
+						for (int c = 0; c < 4; ++c) {
+							out[x * 4 + c] = static_cast<uint8_t>(sum[c] * inv + 0.5f);
+							sum[c] += add[c] - sub[c];
+						}
+					}
+					if (op) op->Apply(out, static_cast<size_t>(w));
+				}
+			});
+		}
+
+		// Bilinear, sampling pixel centres
+		static void RunResize(Image& image, int newWidth, int newHeight, const PointOp* op, ThreadPool& pool) {
+			const int w = image.width;
+			const int h = image.height;
+			const size_t srcStride = static_cast<size_t>(w) * 4;
+			const size_t dstStride = static_cast<size_t>(newWidth) * 4;
+			const uint8_t* src = static_cast<const uint8_t*>(image.data);
+			uint8_t* dst = static_cast<uint8_t*>(MemAlloc(static_cast<unsigned int>(dstStride * newHeight)));
+
+			std::vector<int> xs(static_cast<size_t>(newWidth) * 2);
+			std::vector<float> xw(static_cast<size_t>(newWidth));
+			const float sx = static_cast<float>(w) / newWidth;
+			for (int x = 0; x < newWidth; ++x) {
+				float fx = std::clamp((x + 0.5f) * sx - 0.5f, 0.0f, static_cast<float>(w - 1));
+				int ix = static_cast<int>(fx);
+				xs[x * 2] = ix * 4;
+				xs[x * 2 + 1] = std::min(ix + 1, w - 1) * 4;
+				xw[x] = fx - ix;
+			}
+
+			const float sy = static_cast<float>(h) / newHeight;
+			pool.ParallelFor(static_cast<size_t>(newHeight), RowsPerTile(newWidth), [&](size_t y0, size_t y1) {
+				for (size_t y = y0; y < y1; ++y) {
+					float fy = std::clamp((y + 0.5f) * sy - 0.5f, 0.0f, static_cast<float>(h - 1));
+					int iy = static_cast<int>(fy);
+					float wy = fy - iy;
+					const uint8_t* r0 = src + iy * srcStride;
+					const uint8_t* r1 = src + std::min(iy + 1, h - 1) * srcStride;
+					uint8_t* out = dst + y * dstStride;
+					for (int x = 0; x < newWidth; ++x) {
+						const int a = xs[x * 2];
+						const int b = xs[x * 2 + 1];
+						const float wx = xw[x];
+						for (int c = 0; c < 4; ++c) {
+							float top = r0[a + c] + (r0[b + c] - r0[a + c]) * wx;
+							float bottom = r1[a + c] + (r1[b + c] - r1[a + c]) * wx;
+							out[x * 4 + c] = static_cast<uint8_t>(top + (bottom - top) * wy + 0.5f);
+						}
+					}
+					if (op) op->Apply(out, static_cast<size_t>(newWidth));
+				}
+			});
+
+			Replace(image, dst, newWidth, newHeight);
+		}
+
+		static void RunMipmaps(Image& image, ThreadPool& pool) {
+			size_t total = 0;
+			int levels = 0;
+			for (int w = image.width, h = image.height;; w = std::max(1, w / 2), h = std::max(1, h / 2)) {
+				total += static_cast<size_t>(w) * h * 4;
+				++levels;
+				if (w == 1 && h == 1) break;
+			}
+
+			uint8_t* data = static_cast<uint8_t*>(MemAlloc(static_cast<unsigned int>(total)));
+			std::memcpy(data, image.data, static_cast<size_t>(image.width) * image.height * 4);
+
+			uint8_t* prev = data;
+			int pw = image.width;
+			int ph = image.height;
+			for (int level = 1; level < levels; ++level) {
+				uint8_t* next = prev + static_cast<size_t>(pw) * ph * 4;
+				const int nw = std::max(1, pw / 2);
+				const int nh = std::max(1, ph / 2);
+				pool.ParallelFor(static_cast<size_t>(nh), RowsPerTile(nw), [&](size_t y0, size_t y1) {
+					for (size_t y = y0; y < y1; ++y) {
+						const uint8_t* r0 = prev + std::min<size_t>(y * 2, ph - 1) * pw * 4;
+						const uint8_t* r1 = prev + std::min<size_t>(y * 2 + 1, ph - 1) * pw * 4;
+						uint8_t* out = next + y * nw * 4;
+						for (int x = 0; x < nw; ++x) {
+							const int a = std::min(x * 2, pw - 1) * 4;
+							const int b = std::min(x * 2 + 1, pw - 1) * 4;
+							for (int c = 0; c < 4; ++c)
+								out[x * 4 + c] = static_cast<uint8_t>((r0[a + c] + r0[b + c] + r1[a + c] + r1[b + c] + 2) >> 2);
+						}
+					}
+				});
+				prev = next;
+				pw = nw;
+				ph = nh;
+			}
+
+			int width = image.width;
+			int height = image.height;
+			Replace(image, data, width, height);
+			image.mipmaps = levels;
+		}
+
+		static void RunFormat(Image& image, int format, ThreadPool& pool) {
+			int channels = 0;
+			if (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+			else if (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+			else if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+			else if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+
+			if (channels == 0) {
+				ImageFormat(&image, format);	// everything else goes through raylib
+				return;
+			}
+
+			size_t pixels = 0;
+			for (int level = 0, w = image.width, h = image.height; level < image.mipmaps; ++level, w = std::max(1, w / 2), h = std::max(1, h / 2))
+				pixels += static_cast<size_t>(w) * h;
+
+			const uint8_t* src = static_cast<const uint8_t*>(image.data);
+			uint8_t* dst = static_cast<uint8_t*>(MemAlloc(static_cast<unsigned int>(pixels * channels)));
+			pool.ParallelFor(pixels, TileBytes / 4, [&](size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					const uint8_t* px = src + i * 4;
+					uint8_t* out = dst + i * channels;
+					if (channels == 3) {
+						out[0] = px[0];
+						out[1] = px[1];
+						out[2] = px[2];
+					}
+					else {
+						out[0] = static_cast<uint8_t>(px[0] * 0.299f + px[1] * 0.587f + px[2] * 0.114f + 0.5f);
+						if (channels == 2) out[1] = px[3];
+					}
+				}
+			});
+
+			int mipmaps = image.mipmaps;
+			Replace(image, dst, image.width, image.height);
+			image.mipmaps = mipmaps;
+			image.format = format;
+		}
+
+		std::vector<Stage> m_stages;
+	};
+
+	struct DynamicFontStats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+		uint64_t dropped = 0;	// glyphs that did not fit even after eviction, drawn as '?'
+		uint64_t failed = 0;	// codepoints the font data could not rasterize; not retried, drawn as '?'
+		uint64_t atlasGrowths = 0;
+		size_t residentGlyphs = 0;
+		size_t atlasBytes = 0;
+
+		float MissRate() const {
+			uint64_t lookups = hits + misses;
+			return lookups ? static_cast<float>(misses) / static_cast<float>(lookups) : 0.0f;
+		}
+	};
+
+	// Keeps the TTF data resident and rasterizes glyphs on first use into a growable, shelf-packed
+	// GRAY_ALPHA atlas. Once the atlas reaches its maximum size, the least recently used shelf is evicted.
+	// Prepare() must run on the thread that owns the GL context; rasterization is spread over the ThreadPool.
+	class DynamicFont {
+	public:
+		DynamicFont(const char* fileName, int fontSize, int atlasSize = 512, int maxAtlasSize = 4096)
+			: m_fontSize(fontSize), m_maxAtlasSize(maxAtlasSize)
+		{
+			int size = 0;
+			unsigned char* data = LoadFileData(fileName, &size);
+			if (!data)
+				throw std::runtime_error(std::string("Failed to load font file: ") + fileName);
+			m_fileData.assign(data, data + size);
+			UnloadFileData(data);
+			InitAtlas(atlasSize);
+		}
+
+		DynamicFont(const unsigned char* fileData, int dataSize, int fontSize, int atlasSize = 512, int maxAtlasSize = 4096)
+			: m_fileData(fileData, fileData + dataSize), m_fontSize(fontSize), m_maxAtlasSize(maxAtlasSize)
+		{
+			InitAtlas(atlasSize);
+		}
+
+		DynamicFont(const DynamicFont&) = delete;
+		DynamicFont& operator=(const DynamicFont&) = delete;
+
+		~DynamicFont() {
+			if (m_texture.id != 0)
+				UnloadTexture(m_texture);
+		}
+
+		// Makes every codepoint in text resident and returns the font to draw or measure it with
+		const Font& Prepare(const char* text) {
+			BeginPrepare();
+			for (const char* p = text; *p;) {
+				int size = 0;
+				int codepoint = GetCodepointNext(p, &size);
+				p += size > 0 ? size : 1;
+				Touch(codepoint);
+			}
+			Flush();
+			return m_font;
+		}
+
+		const Font& Prepare(const int* codepoints, int count) {
+			BeginPrepare();
+			for (int i = 0; i < count; ++i)
+				Touch(codepoints[i]);
+			Flush();
+			return m_font;
+		}
+
+		Vector2 Measure(const char* text, float fontSize, float spacing) {
+			return MeasureTextEx(Prepare(text), text, fontSize, spacing);
+		}
+
+		// Advances the LRU clock; call once per frame
+		void NextFrame() { ++m_frame; }
+
+		const Font& GetFont() const { return m_font; }
+		operator const Font& () const { return m_font; }
+
+		const Image& GetAtlas() const { return m_atlas; }
+		const DynamicFontStats& GetStats() const { return m_stats; }
+		void ResetStats() { m_stats.hits = m_stats.misses = m_stats.evictions = m_stats.dropped = m_stats.failed = m_stats.atlasGrowths = 0; }
+
+	private:
+		static constexpr int GlyphPadding = 1;
+		static constexpr int FallbackCodepoint = '?';
+
+		struct Shelf {
+			int y = 0;
+			int height = 0;
+			int cursor = 0;
+			uint64_t lastUsed = 0;
+			std::vector<int> codepoints;
+		};
+
+		struct Slot {
+			uint32_t index = 0;	// into m_glyphs / m_recs
+			uint32_t shelf = 0;
+		};
+
+		void InitAtlas(int atlasSize) {
+			if (m_fileData.empty() || m_fontSize <= 0)
+				throw std::invalid_argument("DynamicFont requires font data and a positive size.");
+			// Glyphs are rasterized lazily, so check up front that the data is a font raylib can read
+			int probe = FallbackCodepoint;
+			GlyphInfo* glyph = LoadFontData(m_fileData.data(), static_cast<int>(m_fileData.size()), m_fontSize, &probe, 1, FONT_DEFAULT);
+			if (!glyph)
+				throw std::runtime_error("DynamicFont could not load the font data.");
+			UnloadFontData(glyph, 1);
+			m_atlas = Managed<Image>(GenImageColor(atlasSize, atlasSize, BLANK));
+			ImageFormat(&*m_atlas, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+			m_font.baseSize = m_fontSize;
+			m_font.glyphPadding = GlyphPadding;
+			m_stats.atlasBytes = AtlasBytes();
+		}
+
+		void BeginPrepare() {
+			m_pending.clear();
+			if (!m_slots.contains(FallbackCodepoint) && !m_failed.contains(FallbackCodepoint))
+				m_pending.push_back(FallbackCodepoint);
+		}
+
+		size_t AtlasBytes() const { return static_cast<size_t>(m_atlas->width) * m_atlas->height * 2; }
+
+		void Touch(int codepoint) {
+			auto it = m_slots.find(codepoint);
+			if (it != m_slots.end()) {
+				++m_stats.hits;
+				m_shelves[it->second.shelf].lastUsed = m_frame;
+				return;
+			}
+			if (m_failed.contains(codepoint))
+				return;
+			if (std::find(m_pending.begin(), m_pending.end(), codepoint) == m_pending.end()) {
+				++m_stats.misses;
+				m_pending.push_back(codepoint);
+			}
+		}
+
+		void Flush() {
+			if (!m_pending.empty()) {
+				Rasterize();
+				for (size_t i = 0; i < m_rasterized.size(); ++i) {
+					if (!m_loaded[i]) {
+						m_failed.insert(m_pending[i]);	// failed batch: nothing to place
+						++m_stats.failed;
+						continue;
+					}
+					Place(m_rasterized[i]);
+					UnloadImage(m_rasterized[i].image);
+				}
+				m_rasterized.clear();
+				m_pending.clear();
+
+				m_font.glyphs = m_glyphs.data();
+				m_font.recs = m_recs.data();
+				m_font.glyphCount = static_cast<int>(m_glyphs.size());
+				m_stats.residentGlyphs = m_glyphs.size();
+			}
+			Upload();
+		}
+
+		// Batches of codepoints go to LoadFontData on worker threads; m_loaded marks the ones that succeeded
+		void Rasterize() {
+			constexpr size_t Batch = 16;
+			m_rasterized.assign(m_pending.size(), GlyphInfo{});
+			m_loaded.assign(m_pending.size(), 0);
+			ThreadPool::Instance().ParallelFor(m_pending.size(), Batch, [&](size_t begin, size_t end) {
+				GlyphInfo* glyphs = LoadFontData(m_fileData.data(), static_cast<int>(m_fileData.size()), m_fontSize,
+					m_pending.data() + begin, static_cast<int>(end - begin), FONT_DEFAULT);
+				if (!glyphs) return;
+				std::fill(m_loaded.begin() + begin, m_loaded.begin() + end, uint8_t(1));
+				std::copy(glyphs, glyphs + (end - begin), m_rasterized.begin() + begin);
+				MemFree(glyphs);	// images now owned by m_rasterized
+			});
+		}
+
+		void Place(const GlyphInfo& glyph) {
+			const int w = glyph.image.width + GlyphPadding * 2;
+			const int h = glyph.image.height + GlyphPadding * 2;
+			int shelf = -1;
+			int x = 0;
+			while (!Allocate(w, h, shelf, x)) {
+				if (!Grow() && !Evict(h)) {
+					++m_stats.dropped;
+					return;
+				}
+			}
+
+			Shelf& s = m_shelves[shelf];
+			s.codepoints.push_back(glyph.value);
+			s.lastUsed = m_frame;
+
+			const int gx = x + GlyphPadding;
+			const int gy = s.y + GlyphPadding;
+			if (glyph.image.data && glyph.image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) {
+				const uint8_t* src = static_cast<const uint8_t*>(glyph.image.data);
+				uint8_t* dst = static_cast<uint8_t*>(m_atlas->data);
+				for (int row = 0; row < glyph.image.height; ++row) {
+					uint8_t* out = dst + (static_cast<size_t>(gy + row) * m_atlas->width + gx) * 2;
+					for (int col = 0; col < glyph.image.width; ++col) {
+						out[col * 2] = 255;
+						out[col * 2 + 1] = src[row * glyph.image.width + col];
+					}
+				}
+			}
+			MarkDirty(x, s.y, w, h);
+
+			GlyphInfo info = glyph;
+			info.image = Image{};
+			m_slots[glyph.value] = Slot{ static_cast<uint32_t>(m_glyphs.size()), static_cast<uint32_t>(shelf) };
+			m_glyphs.push_back(info);
+			m_recs.push_back(rlRectangle{ (float)gx, (float)gy, (float)glyph.image.width, (float)glyph.image.height });
+		}
+
+		// Best-fit shelf: the shortest one tall enough with room left, else a new shelf at the bottom
+		bool Allocate(int w, int h, int& shelf, int& x) {
+			if (w > m_atlas->width) return false;
+			int best = -1;
+			for (size_t i = 0; i < m_shelves.size(); ++i) {
+				const Shelf& s = m_shelves[i];
+				if (s.height >= h && s.cursor + w <= m_atlas->width && (best < 0 || s.height < m_shelves[best].height))
+					best = static_cast<int>(i);
+			}
+			if (best >= 0 && m_shelves[best].height <= h + h / 2) {
+				shelf = best;
+			}
+			else {
+				int top = m_shelves.empty() ? 0 : m_shelves.back().y + m_shelves.back().height;
+				if (top + h <= m_atlas->height) {
+					m_shelves.push_back(Shelf{ top, h, 0, m_frame, {} });
+					shelf = static_cast<int>(m_shelves.size() - 1);
+				}
+				else if (best >= 0) {
+					shelf = best;
+				}
+				else {
+					return false;
+				}
+			}
+			x = m_shelves[shelf].cursor;
+			m_shelves[shelf].cursor += w;
+			return true;
+		}
+
+		// Doubles the atlas height (then width) up to the maximum; existing glyphs keep their coordinates
+		bool Grow() {
+			int w = m_atlas->width;
+			int h = m_atlas->height;
+			if (h < m_maxAtlasSize) h = std::min(h * 2, m_maxAtlasSize);
+			else if (w < m_maxAtlasSize) w = std::min(w * 2, m_maxAtlasSize);
+			else return false;
+
+			Managed<Image> grown(GenImageColor(w, h, BLANK));
+			ImageFormat(&*grown, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+			const size_t oldStride = static_cast<size_t>(m_atlas->width) * 2;
+			for (int row = 0; row < m_atlas->height; ++row)
+				std::memcpy(static_cast<uint8_t*>(grown->data) + row * static_cast<size_t>(w) * 2,
+					static_cast<const uint8_t*>(m_atlas->data) + row * oldStride, oldStride);
+			m_atlas = std::move(grown);
+			m_textureStale = true;
+			++m_stats.atlasGrowths;
+			m_stats.atlasBytes = AtlasBytes();
+			return true;
+		}
+
+		// Clears the least recently used shelf tall enough for h that was not touched this frame. Shelves holding
+		// only the pinned fallback have nothing to free and are skipped; false means no space could be reclaimed
+		bool Evict(int h) {
+			int victim = -1;
+			for (size_t i = 0; i < m_shelves.size(); ++i) {
+				const Shelf& s = m_shelves[i];
+				if (s.height < h || s.lastUsed >= m_frame) continue;
+				if (std::all_of(s.codepoints.begin(), s.codepoints.end(), [](int c) { return c == FallbackCodepoint; })) continue;
+				if (victim < 0 || s.lastUsed < m_shelves[victim].lastUsed)
+					victim = static_cast<int>(i);
+			}
+			if (victim < 0) return false;
+
+			Shelf& s = m_shelves[victim];
+			for (int codepoint : s.codepoints) {
+				if (codepoint == FallbackCodepoint) continue;
+				auto it = m_slots.find(codepoint);
+				if (it == m_slots.end()) continue;
+				uint32_t index = it->second.index;
+				uint32_t last = static_cast<uint32_t>(m_glyphs.size() - 1);
+				if (index != last) {
+					m_glyphs[index] = m_glyphs[last];
+					m_recs[index] = m_recs[last];
+					m_slots[m_glyphs[index].value].index = index;
+				}
+				m_glyphs.pop_back();
+				m_recs.pop_back();
+				m_slots.erase(it);
+				++m_stats.evictions;
+			}
+
+			// The fallback glyph is never evicted; keep it by restarting the shelf after it. Stamping the shelf
+			// keeps a placement that still does not fit from picking it again this frame
+			s.lastUsed = m_frame;
+			s.cursor = 0;
+			s.codepoints.clear();
+			auto fallback = m_slots.find(FallbackCodepoint);
+			if (fallback != m_slots.end() && fallback->second.shelf == static_cast<uint32_t>(victim)) {
+				const rlRectangle& rec = m_recs[fallback->second.index];
+				s.cursor = static_cast<int>(rec.x + rec.width) + GlyphPadding;
+				s.codepoints.push_back(FallbackCodepoint);
+			}
+
+			uint8_t* dst = static_cast<uint8_t*>(m_atlas->data);
+			for (int row = s.y; row < s.y + s.height; ++row)
+				std::memset(dst + (static_cast<size_t>(row) * m_atlas->width + s.cursor) * 2, 0, static_cast<size_t>(m_atlas->width - s.cursor) * 2);
+			MarkDirty(s.cursor, s.y, m_atlas->width - s.cursor, s.height);
+			return true;
+		}
+
+		void MarkDirty(int x, int y, int w, int h) {
+			if (m_dirtyW == 0) {
+				m_dirtyX = x;
+				m_dirtyY = y;
+				m_dirtyW = w;
+				m_dirtyH = h;
+				return;
+			}
+			int right = std::max(m_dirtyX + m_dirtyW, x + w);
+			int bottom = std::max(m_dirtyY + m_dirtyH, y + h);
+			m_dirtyX = std::min(m_dirtyX, x);
+			m_dirtyY = std::min(m_dirtyY, y);
+			m_dirtyW = right - m_dirtyX;
+			m_dirtyH = bottom - m_dirtyY;
+		}
+
+		void Upload() {
+			if (m_texture.id == 0 || m_textureStale) {
+				if (m_texture.id != 0)
+					UnloadTexture(m_texture);
+				m_texture = LoadTextureFromImage(m_atlas);
+				SetTextureFilter(m_texture, TEXTURE_FILTER_BILINEAR);
+				m_font.texture = m_texture;
+				m_textureStale = false;
+			}
+			else if (m_dirtyW > 0 && m_dirtyH > 0) {
+				const size_t rowBytes = static_cast<size_t>(m_dirtyW) * 2;
+				m_upload.resize(rowBytes * m_dirtyH);
+				for (int row = 0; row < m_dirtyH; ++row)
+					std::memcpy(m_upload.data() + row * rowBytes,
+						static_cast<const uint8_t*>(m_atlas->data) + (static_cast<size_t>(m_dirtyY + row) * m_atlas->width + m_dirtyX) * 2, rowBytes);
+				UpdateTextureRec(m_texture, rlRectangle{ (float)m_dirtyX, (float)m_dirtyY, (float)m_dirtyW, (float)m_dirtyH }, m_upload.data());
+			}
+			m_dirtyW = m_dirtyH = 0;
+		}
+
+		std::vector<unsigned char> m_fileData;
+		int m_fontSize = 0;
+		int m_maxAtlasSize = 0;
+
+		Managed<Image> m_atlas{};
+		Texture2D m_texture{};
+		bool m_textureStale = true;
+		std::vector<uint8_t> m_upload;
+		int m_dirtyX = 0;
+		int m_dirtyY = 0;
+		int m_dirtyW = 0;
+		int m_dirtyH = 0;
+
+		Font m_font{};
+		std::vector<GlyphInfo> m_glyphs;
+		std::vector<rlRectangle> m_recs;
+		std::unordered_map<int, Slot> m_slots;
+		std::vector<Shelf> m_shelves;
+
+		std::vector<int> m_pending;
+		std::vector<GlyphInfo> m_rasterized;
+		std::vector<uint8_t> m_loaded;
+		std::unordered_set<int> m_failed;
+		uint64_t m_frame = 1;
+		DynamicFontStats m_stats{};
+	};
+
+	inline void DrawTextAlignedEx(DynamicFont& font, const char* text, rlRectangle rec, float fontsize, float spacing, Color rgba, TextAlign align)
+	{
+		DrawTextAlignedEx(font.Prepare(text), text, rec, fontsize, spacing, rgba, align);
+	}
+
+	inline void DrawTextAlignedEx(DynamicFont& font, const char* text, float x, float y, float width, float height, float fontsize, float spacing, Color rgba, TextAlign align)
+	{
+		DrawTextAlignedEx(font, text, { x, y, width, height }, fontsize, spacing, rgba, align);
+	}
+
+	struct ParticleEmitter {
+		Vector2 position{};
+		Vector2 spread{};			// +/- random offset around position
+		Vector2 velocityMin{};
+		Vector2 velocityMax{};
+		float lifetimeMin = 1.0f;
+		float lifetimeMax = 1.0f;
+		RGBA color{ 255, 255, 255, 255 };
+	};
+
+	// Fixed-capacity particle pool stored SoA. Update() runs a vectorized kernel across the ThreadPool and
+	// swap-and-pop compacts dead particles; Draw() submits every particle as one rlgl quad batch.
+	// Alpha fades linearly with remaining lifetime.
+	class ParticleSystem {
+	public:
+		explicit ParticleSystem(size_t capacity, uint64_t seed = 0x9E3779B97F4A7C15ull)
+			: m_x(capacity), m_y(capacity), m_vx(capacity), m_vy(capacity),
+			  m_life(capacity), m_invLifetime(capacity), m_color(capacity), m_seed(seed) {}
+
+		void SetGravity(Vector2 gravity) { m_gravity = gravity; }
+		Vector2 GetGravity() const { return m_gravity; }
+
+		// Returns the number emitted, limited by free capacity
+		size_t Emit(const ParticleEmitter& emitter, size_t count, ThreadPool& pool = ThreadPool::Instance()) {
+			const size_t first = m_count;
+			count = std::min(count, Capacity() - m_count);
+			m_count += count;
+			const uint64_t seed = m_seed;
+			m_seed = SplitMix(m_seed);
+
+			const uint32_t color = emitter.color;
+			pool.ParallelFor(count, EmitGrain, [&](size_t begin, size_t end) {
+				uint64_t state = seed ^ (begin * 0xBF58476D1CE4E5B9ull);
+				for (size_t k = begin; k < end; ++k) {
+					const size_t i = first + k;
+					m_x[i] = emitter.position.x + emitter.spread.x * (Random(state) * 2.0f - 1.0f);
+					m_y[i] = emitter.position.y + emitter.spread.y * (Random(state) * 2.0f - 1.0f);
+					m_vx[i] = emitter.velocityMin.x + (emitter.velocityMax.x - emitter.velocityMin.x) * Random(state);
+					m_vy[i] = emitter.velocityMin.y + (emitter.velocityMax.y - emitter.velocityMin.y) * Random(state);
+					float lifetime = std::max(emitter.lifetimeMin + (emitter.lifetimeMax - emitter.lifetimeMin) * Random(state), 1e-4f);
+					m_life[i] = lifetime;
+					m_invLifetime[i] = 1.0f / lifetime;
+					m_color[i] = color;
+				}
+			});
+			return count;
+		}
+
+		void Update(float dt, ThreadPool& pool = ThreadPool::Instance()) {
+			std::atomic<size_t> dead{ 0 };
+			pool.ParallelFor(m_count, UpdateGrain, [&](size_t begin, size_t end) {
+				size_t died = Integrate(begin, end, dt);
+				if (died) dead.fetch_add(died, std::memory_order_relaxed);
+			});
+			if (dead.load(std::memory_order_relaxed) > 0)
+				Compact();
+		}
+
+		void Draw(const Texture2D& texture, float size) const {
+			const float half = size * 0.5f;
+			rlSetTexture(texture.id);
+			rlBegin(RL_QUADS);
+			rlNormal3f(0.0f, 0.0f, 1.0f);
+			for (size_t i = 0; i < m_count; ++i) {
+				rlCheckRenderBatchLimit(4);
+				const uint32_t c = m_color[i];
+				const float fade = std::clamp(m_life[i] * m_invLifetime[i], 0.0f, 1.0f);
+				rlColor4ub(c & 0xFF, (c >> 8) & 0xFF, (c >> 16) & 0xFF, static_cast<unsigned char>(((c >> 24) & 0xFF) * fade));
+				const float x = m_x[i];
+				const float y = m_y[i];
+				rlTexCoord2f(0.0f, 0.0f); rlVertex2f(x - half, y - half);
+				rlTexCoord2f(0.0f, 1.0f); rlVertex2f(x - half, y + half);
+				rlTexCoord2f(1.0f, 1.0f); rlVertex2f(x + half, y + half);
+				rlTexCoord2f(1.0f, 0.0f); rlVertex2f(x + half, y - half);
+			}
+			rlEnd();
+			rlSetTexture(0);
+		}
+
+		void Clear() { m_count = 0; }
+
+		size_t Size() const { return m_count; }
+		size_t Capacity() const { return m_x.size(); }
+
+		// --- SoA access ---
+		const float* GetX() const { return m_x.data(); }
+		const float* GetY() const { return m_y.data(); }
+		const float* GetVelocityX() const { return m_vx.data(); }
+		const float* GetVelocityY() const { return m_vy.data(); }
+		const float* GetLife() const { return m_life.data(); }
+		const uint32_t* GetColor() const { return m_color.data(); }
+
+	private:
+		static constexpr size_t UpdateGrain = 16384;
+		static constexpr size_t EmitGrain = 4096;
+
+		static uint64_t SplitMix(uint64_t x) {
+			x += 0x9E3779B97F4A7C15ull;
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+			return x ^ (x >> 31);
+		}
+
+		// [0, 1)
+		static float Random(uint64_t& state) {
+			state = SplitMix(state);
+			return static_cast<float>(state >> 40) * (1.0f / 16777216.0f);
+		}
+
+		// Returns how many particles in [begin, end) expired
+		size_t Integrate(size_t begin, size_t end, float dt) {
+			const float gx = m_gravity.x * dt;
+			const float gy = m_gravity.y * dt;
+			size_t died = 0;
+			size_t i = begin;
+#ifdef RLX_SSE2
+			const __m128 vdt = _mm_set1_ps(dt);
+			const __m128 vgx = _mm_set1_ps(gx);
+			const __m128 vgy = _mm_set1_ps(gy);
+			const __m128 zero = _mm_setzero_ps();
+			for (; i + 4 <= end; i += 4) {
+				__m128 vx = _mm_add_ps(_mm_loadu_ps(&m_vx[i]), vgx);
+				__m128 vy = _mm_add_ps(_mm_loadu_ps(&m_vy[i]), vgy);
+				_mm_storeu_ps(&m_vx[i], vx);
+				_mm_storeu_ps(&m_vy[i], vy);
+				_mm_storeu_ps(&m_x[i], _mm_add_ps(_mm_loadu_ps(&m_x[i]), _mm_mul_ps(vx, vdt)));
+				_mm_storeu_ps(&m_y[i], _mm_add_ps(_mm_loadu_ps(&m_y[i]), _mm_mul_ps(vy, vdt)));
+				__m128 life = _mm_sub_ps(_mm_loadu_ps(&m_life[i]), vdt);
+				_mm_storeu_ps(&m_life[i], life);
+				int mask = _mm_movemask_ps(_mm_cmple_ps(life, zero));
+				died += static_cast<size_t>((mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1));
+			}
+#endif
+			for (; i < end; ++i) {
+				m_vx[i] += gx;
+				m_vy[i] += gy;
+				m_x[i] += m_vx[i] * dt;
+				m_y[i] += m_vy[i] * dt;
+				m_life[i] -= dt;
+				if (m_life[i] <= 0.0f) ++died;
+			}
+			return died;
+		}
+
+		void Compact() {
+			size_t i = 0;
+			while (i < m_count) {
+				if (m_life[i] > 0.0f) {
+					++i;
+					continue;
+				}
+				const size_t last = --m_count;
+				m_x[i] = m_x[last];
+				m_y[i] = m_y[last];
+				m_vx[i] = m_vx[last];
+				m_vy[i] = m_vy[last];
+				m_life[i] = m_life[last];
+				m_invLifetime[i] = m_invLifetime[last];
+				m_color[i] = m_color[last];
+			}
+		}
+
+		std::vector<float> m_x;
+		std::vector<float> m_y;
+		std::vector<float> m_vx;
+		std::vector<float> m_vy;
+		std::vector<float> m_life;
+		std::vector<float> m_invLifetime;
+		std::vector<uint32_t> m_color;	// RGBA8888, as rlx::RGBA packs it
+		size_t m_count = 0;
+
+		Vector2 m_gravity{ 0.0f, 0.0f };
+		uint64_t m_seed;
+	};
+
+	// Large tile grid split into ChunkSize x ChunkSize chunks. Tiles are stored as per-chunk palette indices
+	// (one byte per tile until a chunk uses more than 256 distinct tiles). Each visible non-empty chunk is
+	// baked into a pooled RenderTexture2D and only re-baked after one of its tiles changes.
+	// Maps saved with Save() can be opened with Open() and stream their chunks in as they become visible.
+	class TileMap {
+	public:
+		using TileId = uint16_t;
+		static constexpr TileId EmptyTile = 0;	// tile N (1-based) is tileset cell N - 1, row-major
+		static constexpr int ChunkSize = 32;
+
+		struct Stats {
+			size_t visibleChunks = 0;
+			size_t bakedChunks = 0;
+			size_t bakesThisFrame = 0;
+			size_t loadedChunks = 0;
+			size_t tileBytes = 0;
+		};
+
+		TileMap(int width, int height, int tileSize, const Texture2D& tileset, size_t maxBakedChunks = 256)
+			: m_width(width), m_height(height), m_tileSize(tileSize), m_tileset(tileset), m_maxBaked(maxBakedChunks)
+		{
+			if (width <= 0 || height <= 0 || tileSize <= 0)
+				throw std::invalid_argument("TileMap requires a positive size and tile size.");
+			m_chunksX = (width + ChunkSize - 1) / ChunkSize;
+			m_chunksY = (height + ChunkSize - 1) / ChunkSize;
+			m_chunks.resize(static_cast<size_t>(m_chunksX) * m_chunksY);
+			for (Chunk& chunk : m_chunks)
+				chunk.loaded = true;
+		}
+
+		// Streams chunks from a file written by Save()
+		static std::unique_ptr<TileMap> Open(const std::filesystem::path& path, int tileSize, const Texture2D& tileset, size_t maxBakedChunks = 256) {
+			auto stream = std::make_unique<std::ifstream>(path, std::ios::binary);
+			if (!*stream)
+				throw std::runtime_error("Failed to open tile map: " + path.string());
+
+			FileHeader header{};
+			stream->read(reinterpret_cast<char*>(&header), sizeof(header));
+			if (!*stream || std::memcmp(header.magic, "RLXT", 4) != 0 || header.version != FileVersion || header.chunkSize != ChunkSize)
+				throw std::runtime_error("Invalid tile map file: " + path.string());
+
+			auto map = std::make_unique<TileMap>(static_cast<int>(header.width), static_cast<int>(header.height), tileSize, tileset, maxBakedChunks);
+			map->m_table.resize(map->m_chunks.size());
+			stream->read(reinterpret_cast<char*>(map->m_table.data()), static_cast<std::streamsize>(map->m_table.size() * sizeof(ChunkEntry)));
+			if (!*stream)
+				throw std::runtime_error("Truncated tile map file: " + path.string());
+
+			for (size_t i = 0; i < map->m_chunks.size(); ++i)
+				map->m_chunks[i].loaded = map->m_table[i].size == 0;	// empty chunks need no read
+			map->m_stream = std::move(stream);
+			map->m_path = path;
+			return map;
+		}
+
+		// Writes a temporary file next to path and renames it over path, so saving over the file this map
+		// streams from is safe: the stream is reopened on the new file and every chunk becomes evictable again.
+		void Save(const std::filesystem::path& path) {
+			std::vector<ChunkEntry> table(m_chunks.size());
+			std::vector<uint8_t> blob;
+			std::vector<uint8_t> all;
+			for (size_t i = 0; i < m_chunks.size(); ++i) {
+				Chunk& chunk = Load(i);
+				if (chunk.nonEmpty == 0) continue;
+				blob.clear();
+				Serialize(chunk, blob);
+				table[i] = ChunkEntry{ sizeof(FileHeader) + table.size() * sizeof(ChunkEntry) + all.size(), static_cast<uint32_t>(blob.size()), 0 };
+				all.insert(all.end(), blob.begin(), blob.end());
+			}
+
+			FileHeader header{};
+			std::memcpy(header.magic, "RLXT", 4);
+			header.version = FileVersion;
+			header.width = static_cast<uint32_t>(m_width);
+			header.height = static_cast<uint32_t>(m_height);
+			header.chunkSize = ChunkSize;
+
+			std::filesystem::path temp = path;
+			temp += ".tmp";
+			{
+				std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+				out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(ChunkEntry)));
+				out.write(reinterpret_cast<const char*>(all.data()), static_cast<std::streamsize>(all.size()));
+				out.close();
+				if (!out) {
+					std::error_code ignored;
+					std::filesystem::remove(temp, ignored);
+					throw std::runtime_error("Failed to write tile map: " + path.string());
+				}
+			}
+
+			std::error_code ec;
+			const bool inPlace = m_stream && std::filesystem::equivalent(path, m_path, ec);
+			if (inPlace)
+				m_stream->close();	// Windows cannot replace a file that is still open
+			std::filesystem::rename(temp, path);
+			if (!inPlace) return;
+
+			m_stream->open(path, std::ios::binary);
+			if (!*m_stream)
+				throw std::runtime_error("Failed to reopen tile map: " + path.string());
+			m_path = path;
+			m_table = std::move(table);
+			for (Chunk& chunk : m_chunks)
+				chunk.modified = false;
+		}
+
+		// --- Tiles ---
+		TileId GetTile(int x, int y) {
+			if (!InBounds(x, y)) return EmptyTile;
+			const Chunk& chunk = Load(ChunkIndex(x / ChunkSize, y / ChunkSize));
+			if (chunk.indices.empty()) return EmptyTile;
+			return chunk.palette[ReadIndex(chunk, LocalIndex(x, y))];
+		}
+
+		void SetTile(int x, int y, TileId id) {
+			if (!InBounds(x, y)) return;
+			Chunk& chunk = Load(ChunkIndex(x / ChunkSize, y / ChunkSize));
+			if (chunk.indices.empty()) {
+				if (id == EmptyTile) return;
+				chunk.indices.assign(ChunkSize * ChunkSize, 0);
+			}
+
+			const size_t local = LocalIndex(x, y);
+			const TileId oldId = chunk.palette[ReadIndex(chunk, local)];
+			if (oldId == id) return;
+
+			uint16_t newIndex = PaletteIndex(chunk, id);	// may compact the palette and renumber indices
+			WriteIndex(chunk, local, newIndex);
+			if (oldId == EmptyTile) ++chunk.nonEmpty;
+			if (id == EmptyTile) --chunk.nonEmpty;
+
+			if (chunk.nonEmpty == 0) {
+				chunk.indices.clear();
+				chunk.indices.shrink_to_fit();
+				chunk.palette.assign(1, EmptyTile);
+				chunk.wide = false;
+				ReleaseTexture(chunk);
+			}
+			chunk.dirty = true;
+			chunk.modified = true;
+		}
+
+		void Fill(const Rectangle<int>& area, TileId id) {
+			for (int y = std::max(area.y, 0); y < std::min(area.bottom(), m_height); ++y)
+				for (int x = std::max(area.x, 0); x < std::min(area.right(), m_width); ++x)
+					SetTile(x, y, id);
+		}
+
+		// --- Rendering ---
+		// Culls chunks against the camera view, streams them in and bakes dirty ones.
+		// Call outside BeginMode2D (baking switches render targets), then Draw() inside it.
+		void Prepare(const Camera2D& camera, int screenWidth = GetScreenWidth(), int screenHeight = GetScreenHeight()) {
+			++m_frame;
+			m_stats.bakesThisFrame = 0;
+			m_visible.clear();
+
+			const Rectangle<float> view = GetViewRect(camera, screenWidth, screenHeight);
+			const float chunkPx = static_cast<float>(ChunkSize * m_tileSize);
+			const int cx0 = std::max(0, static_cast<int>(std::floor(view.x / chunkPx)));
+			const int cy0 = std::max(0, static_cast<int>(std::floor(view.y / chunkPx)));
+			const int cx1 = std::min(m_chunksX - 1, static_cast<int>(std::floor(view.right() / chunkPx)));
+			const int cy1 = std::min(m_chunksY - 1, static_cast<int>(std::floor(view.bottom() / chunkPx)));
+
+			for (int cy = cy0; cy <= cy1; ++cy) {
+				for (int cx = cx0; cx <= cx1; ++cx) {
+					Rectangle<float> bounds{ cx * chunkPx, cy * chunkPx, chunkPx, chunkPx };
+					if (!bounds.intersects(view)) continue;
+					size_t index = ChunkIndex(cx, cy);
+					Chunk& chunk = Load(index);
+					chunk.lastVisible = m_frame;
+					if (chunk.nonEmpty == 0) continue;
+					m_visible.push_back(static_cast<uint32_t>(index));
+				}
+			}
+
+			for (uint32_t index : m_visible) {
+				Chunk& chunk = m_chunks[index];
+				if (chunk.texture < 0 || chunk.dirty)
+					Bake(index);
+			}
+
+			if (m_stream)
+				UnloadStale();
+
+			m_stats.visibleChunks = m_visible.size();
+		}
+
+		// Draws the chunks found by the last Prepare(); call inside BeginMode2D with the same camera
+		void Draw(Color tint = WHITE) const {
+			const float chunkPx = static_cast<float>(ChunkSize * m_tileSize);
+			for (uint32_t index : m_visible) {
+				const Chunk& chunk = m_chunks[index];
+				Vector2 pos = { (index % m_chunksX) * chunkPx, (index / m_chunksX) * chunkPx };
+				if (chunk.texture >= 0 && !chunk.dirty) {
+					const Texture2D& texture = m_pool[chunk.texture]->texture;
+					DrawTextureRec(texture, { 0.0f, 0.0f, (float)texture.width, -(float)texture.height }, pos, tint);
+				}
+				else {
+					DrawChunkTiles(chunk, pos, tint);	// no texture available this frame
+				}
+			}
+		}
+
+		// --- Streaming ---
+		// Streamed, unmodified chunks unseen for this many frames are dropped from memory
+		void SetUnloadAfterFrames(uint64_t frames) { m_unloadAfter = frames; }
+
+		const Stats& GetStats() {
+			m_stats.bakedChunks = 0;
+			m_stats.loadedChunks = 0;
+			m_stats.tileBytes = 0;
+			for (const Chunk& chunk : m_chunks) {
+				if (chunk.texture >= 0) ++m_stats.bakedChunks;
+				if (chunk.loaded) ++m_stats.loadedChunks;
+				m_stats.tileBytes += chunk.indices.capacity() + chunk.palette.capacity() * sizeof(TileId);
+			}
+			return m_stats;
+		}
+
+		int GetWidth() const { return m_width; }
+		int GetHeight() const { return m_height; }
+		int GetTileSize() const { return m_tileSize; }
+
+	private:
+		static constexpr uint32_t FileVersion = 1;
+
+		struct FileHeader {
+			char magic[4];
+			uint32_t version;
+			uint32_t width;
+			uint32_t height;
+			uint32_t chunkSize;
+			uint32_t reserved;
+		};
+
+		struct ChunkEntry {
+			uint64_t offset = 0;
+			uint32_t size = 0;	// 0 = empty chunk
+			uint32_t reserved = 0;
+		};
+
+		struct Chunk {
+			std::vector<TileId> palette{ EmptyTile };
+			std::vector<uint8_t> indices;	// empty while every tile is EmptyTile
+			bool wide = false;				// two bytes per index
+			bool loaded = false;
+			bool dirty = true;
+			bool modified = false;
+			uint16_t nonEmpty = 0;
+			int texture = -1;
+			uint64_t lastVisible = 0;
+		};
+
+		bool InBounds(int x, int y) const { return x >= 0 && y >= 0 && x < m_width && y < m_height; }
+		size_t ChunkIndex(int cx, int cy) const { return static_cast<size_t>(cy) * m_chunksX + cx; }
+		static size_t LocalIndex(int x, int y) { return static_cast<size_t>(y % ChunkSize) * ChunkSize + (x % ChunkSize); }
+
+		static uint16_t ReadIndex(const Chunk& chunk, size_t local) {
+			if (!chunk.wide) return chunk.indices[local];
+			uint16_t v;
+			std::memcpy(&v, chunk.indices.data() + local * 2, 2);
+			return v;
+		}
+
+		static void WriteIndex(Chunk& chunk, size_t local, uint16_t value) {
+			if (!chunk.wide) chunk.indices[local] = static_cast<uint8_t>(value);
+			else std::memcpy(chunk.indices.data() + local * 2, &value, 2);
+		}
+
+		static uint16_t PaletteIndex(Chunk& chunk, TileId id) {
+			auto it = std::find(chunk.palette.begin(), chunk.palette.end(), id);
+			if (it != chunk.palette.end())
+				return static_cast<uint16_t>(it - chunk.palette.begin());
+
+			// Palettes only grow, so once they could hold every tile of the chunk, drop ids no tile uses
+			if (chunk.palette.size() >= ChunkSize * ChunkSize)
+				CompactPalette(chunk);
+			if (chunk.palette.size() >= std::numeric_limits<uint16_t>::max())
+				throw std::runtime_error("Tile map chunk palette is full.");
+
+			if (chunk.palette.size() == 256 && !chunk.wide) {
+				std::vector<uint8_t> widened(ChunkSize * ChunkSize * 2);
+				for (size_t i = 0; i < ChunkSize * ChunkSize; ++i) {
+					uint16_t v = chunk.indices[i];
+					std::memcpy(widened.data() + i * 2, &v, 2);
+				}
+				chunk.indices = std::move(widened);
+				chunk.wide = true;
+			}
+			chunk.palette.push_back(id);
+			return static_cast<uint16_t>(chunk.palette.size() - 1);
+		}
+
+		// Keeps EmptyTile at index 0 and returns to one byte per tile when the rest fits
+		static void CompactPalette(Chunk& chunk) {
+			std::vector<uint16_t> remap(chunk.palette.size(), 0);
+			remap[0] = 1;
+			for (size_t i = 0; i < ChunkSize * ChunkSize; ++i)
+				remap[ReadIndex(chunk, i)] = 1;
+
+			std::vector<TileId> palette;
+			for (size_t i = 0; i < remap.size(); ++i) {
+				if (!remap[i]) continue;
+				remap[i] = static_cast<uint16_t>(palette.size());
+				palette.push_back(chunk.palette[i]);
+			}
+
+			if (chunk.wide && palette.size() <= 256) {
+				std::vector<uint8_t> narrowed(ChunkSize * ChunkSize);
+				for (size_t i = 0; i < ChunkSize * ChunkSize; ++i)
+					narrowed[i] = static_cast<uint8_t>(remap[ReadIndex(chunk, i)]);
+				chunk.indices = std::move(narrowed);
+				chunk.wide = false;
+			}
+			else {
+				for (size_t i = 0; i < ChunkSize * ChunkSize; ++i)
+					WriteIndex(chunk, i, remap[ReadIndex(chunk, i)]);
+			}
+			chunk.palette = std::move(palette);
+		}
+
+		Chunk& Load(size_t index) {
+			Chunk& chunk = m_chunks[index];
+			if (chunk.loaded) return chunk;
+
+			const ChunkEntry& entry = m_table[index];
+			std::vector<uint8_t> blob(entry.size);
+			m_stream->clear();
+			m_stream->seekg(static_cast<std::streamoff>(entry.offset));
+			m_stream->read(reinterpret_cast<char*>(blob.data()), entry.size);
+			if (!*m_stream || !Deserialize(blob, chunk))
+				throw std::runtime_error("Corrupt tile map chunk.");
+			chunk.loaded = true;
+			chunk.dirty = true;
+			chunk.modified = false;
+			return chunk;
+		}
+
+		// u16 palette count, u16 palette[], u8 wide, indices
+		static void Serialize(const Chunk& chunk, std::vector<uint8_t>& out) {
+			uint16_t count = static_cast<uint16_t>(chunk.palette.size());
+			out.resize(2 + count * 2 + 1);
+			std::memcpy(out.data(), &count, 2);
+			std::memcpy(out.data() + 2, chunk.palette.data(), count * 2);
+			out[2 + count * 2] = chunk.wide ? 1 : 0;
+			out.insert(out.end(), chunk.indices.begin(), chunk.indices.end());
+		}
+
+		static bool Deserialize(const std::vector<uint8_t>& blob, Chunk& chunk) {
+			if (blob.size() < 3) return false;
+			uint16_t count;
+			std::memcpy(&count, blob.data(), 2);
+			const size_t header = 2 + static_cast<size_t>(count) * 2 + 1;
+			if (count == 0 || blob.size() < header) return false;
+			chunk.palette.resize(count);
+			std::memcpy(chunk.palette.data(), blob.data() + 2, count * 2);
+			chunk.wide = blob[header - 1] != 0;
+			if (blob.size() - header != static_cast<size_t>(ChunkSize * ChunkSize) * (chunk.wide ? 2 : 1)) return false;
+			chunk.indices.assign(blob.begin() + header, blob.end());
+
+			chunk.nonEmpty = 0;
+			for (size_t i = 0; i < ChunkSize * ChunkSize; ++i) {
+				uint16_t idx = ReadIndex(chunk, i);
+				if (idx >= count) return false;
+				if (chunk.palette[idx] != EmptyTile) ++chunk.nonEmpty;
+			}
+			return true;
+		}
+
+		Rectangle<float> GetViewRect(const Camera2D& camera, int screenWidth, int screenHeight) const {
+			// Bounding box of the four screen corners, so rotated cameras stay covered
+			Vector2 corners[4] = {
+				GetScreenToWorld2D({ 0.0f, 0.0f }, camera),
+				GetScreenToWorld2D({ (float)screenWidth, 0.0f }, camera),
+				GetScreenToWorld2D({ 0.0f, (float)screenHeight }, camera),
+				GetScreenToWorld2D({ (float)screenWidth, (float)screenHeight }, camera)
+			};
+			float minX = corners[0].x, minY = corners[0].y, maxX = corners[0].x, maxY = corners[0].y;
+			for (const Vector2& c : corners) {
+				minX = std::min(minX, c.x);
+				minY = std::min(minY, c.y);
+				maxX = std::max(maxX, c.x);
+				maxY = std::max(maxY, c.y);
+			}
+			return { minX, minY, maxX - minX, maxY - minY };
+		}
+
+		void DrawChunkTiles(const Chunk& chunk, Vector2 origin, Color tint) const {
+			if (chunk.indices.empty()) return;
+			const int columns = std::max(1, m_tileset.width / m_tileSize);
+			const float ts = static_cast<float>(m_tileSize);
+			for (int ly = 0; ly < ChunkSize; ++ly) {
+				for (int lx = 0; lx < ChunkSize; ++lx) {
+					TileId id = chunk.palette[ReadIndex(chunk, static_cast<size_t>(ly) * ChunkSize + lx)];
+					if (id == EmptyTile) continue;
+					int cell = id - 1;
+					rlRectangle src = { (cell % columns) * ts, (cell / columns) * ts, ts, ts };
+					DrawTextureRec(m_tileset, src, { origin.x + lx * ts, origin.y + ly * ts }, tint);
+				}
+			}
+		}
+
+		void Bake(size_t index) {
+			Chunk& chunk = m_chunks[index];
+			if (chunk.texture < 0 && !AcquireTexture(chunk))
+				return;	// pool exhausted by visible chunks; Draw falls back to tiles
+
+			BeginTextureMode(m_pool[chunk.texture]);
+			ClearBackground(BLANK);
+			DrawChunkTiles(chunk, { 0.0f, 0.0f }, WHITE);
+			EndTextureMode();
+			chunk.dirty = false;
+			++m_stats.bakesThisFrame;
+		}
+
+		bool AcquireTexture(Chunk& chunk) {
+			if (m_freeTextures.empty()) {
+				if (m_pool.size() < m_maxBaked) {
+					m_pool.emplace_back(ChunkSize * m_tileSize, ChunkSize * m_tileSize);
+					m_freeTextures.push_back(static_cast<int>(m_pool.size() - 1));
+				}
+				else {
+					// Reclaim from the chunk that has been out of view the longest
+					Chunk* victim = nullptr;
+					for (Chunk& other : m_chunks)
+						if (other.texture >= 0 && other.lastVisible < m_frame && (!victim || other.lastVisible < victim->lastVisible))
+							victim = &other;
+					if (!victim) return false;
+					ReleaseTexture(*victim);
+				}
+			}
+			chunk.texture = m_freeTextures.back();
+			m_freeTextures.pop_back();
+			return true;
+		}
+
+		void ReleaseTexture(Chunk& chunk) {
+			if (chunk.texture < 0) return;
+			m_freeTextures.push_back(chunk.texture);
+			chunk.texture = -1;
+			chunk.dirty = true;
+		}
+
+		void UnloadStale() {
+			for (size_t i = 0; i < m_chunks.size(); ++i) {
+				Chunk& chunk = m_chunks[i];
+				if (!chunk.loaded || chunk.modified || m_table[i].size == 0 || m_frame - chunk.lastVisible < m_unloadAfter)
+					continue;
+				ReleaseTexture(chunk);
+				chunk.indices.clear();
+				chunk.indices.shrink_to_fit();
+				chunk.palette.assign(1, EmptyTile);
+				chunk.wide = false;
+				chunk.nonEmpty = 0;
+				chunk.loaded = false;
+			}
+		}
+
+		int m_width = 0;
+		int m_height = 0;
+		int m_tileSize = 0;
+		int m_chunksX = 0;
+		int m_chunksY = 0;
+		Texture2D m_tileset{};
+		std::vector<Chunk> m_chunks;
+
+		size_t m_maxBaked = 0;
+		std::vector<Managed<RenderTexture2D>> m_pool;
+		std::vector<int> m_freeTextures;
+		std::vector<uint32_t> m_visible;
+
+		std::unique_ptr<std::ifstream> m_stream;
+		std::filesystem::path m_path;
+		std::vector<ChunkEntry> m_table;
+		uint64_t m_unloadAfter = 600;
+		uint64_t m_frame = 0;
+		Stats m_stats{};
+	};
+
+	// Read-only memory mapping of a whole file
+	class MappedFile {
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::filesystem::path& path) { Open(path); }
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+		MappedFile& operator=(MappedFile&& other) noexcept {
+			if (this != &other) {
+				Close();
+				m_data = std::exchange(other.m_data, nullptr);
+				m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+				m_file = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+				m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+			}
+			return *this;
+		}
+
+		void Open(const std::filesystem::path& path) {
+			Close();
+#ifdef _WIN32
+			m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (m_file == INVALID_HANDLE_VALUE)
+				throw std::runtime_error("Failed to open file: " + path.string());
+			LARGE_INTEGER size{};
+			GetFileSizeEx(m_file, &size);
+			m_size = static_cast<size_t>(size.QuadPart);
+			if (m_size > 0) {
+				m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (m_mapping)
+					m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+				if (!m_data) {
+					Close();
+					throw std::runtime_error("Failed to map file: " + path.string());
+				}
+			}
+#else
+			int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0)
+				throw std::runtime_error("Failed to open file: " + path.string());
+			struct stat st{};
+			if (fstat(fd, &st) != 0) {
+				::close(fd);
+				throw std::runtime_error("Failed to stat file: " + path.string());
+			}
+			m_size = static_cast<size_t>(st.st_size);
+			if (m_size > 0) {
+				void* p = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (p == MAP_FAILED) {
+					::close(fd);
+					m_size = 0;
+					throw std::runtime_error("Failed to map file: " + path.string());
+				}
+				m_data = static_cast<const uint8_t*>(p);
+			}
+			::close(fd);	// the mapping keeps the file referenced
+#endif
+		}
+
+		void Close() {
+#ifdef _WIN32
+			if (m_data) UnmapViewOfFile(m_data);
+			if (m_mapping) CloseHandle(m_mapping);
+			if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+			m_mapping = nullptr;
+			m_file = INVALID_HANDLE_VALUE;
+#else
+			if (m_data) munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+		const uint8_t* Data() const { return m_data; }
+		size_t Size() const { return m_size; }
+		bool IsOpen() const { return m_data != nullptr; }
+
+	private:
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+#ifdef _WIN32
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		HANDLE m_mapping = nullptr;
+#endif
+	};
+
+	// Versioned binary snapshot: header, section table, then 8-byte aligned section payloads.
+	// Sections are arrays or ordered maps of arithmetic types, strings and the rlx geometry types.
+	// Data is stored in host byte order; readers reject files written with the other endianness.
+	namespace Snapshot
+	{
+		inline constexpr char Magic[4] = { 'R', 'L', 'X', 'S' };
+		inline constexpr uint32_t Version = 1;
+		inline constexpr uint32_t EndianMarker = 0x01020304;
+		inline constexpr size_t MaxNameLength = 23;
+
+		enum class SectionKind : uint32_t { Array = 1, Map = 2 };
+
+		struct Header {
+			char magic[4];
+			uint32_t version;
+			uint32_t endian;
+			uint32_t sectionCount;
+			uint64_t fileSize;
+			uint64_t reserved;
+		};
+
+		struct SectionEntry {
+			char name[MaxNameLength + 1];
+			SectionKind kind;
+			uint32_t keyType;
+			uint32_t valueType;
+			uint32_t reserved;
+			uint64_t count;
+			uint64_t offset;
+			uint64_t size;
+		};
+
+		namespace detail
+		{
+			template<typename T> struct IsGeometry : std::false_type {};
+			template<typename T> struct IsGeometry<Rectangle<T>> : std::true_type {};
+			template<typename T> struct IsGeometry<Padding<T>> : std::true_type {};
+			template<typename T> struct IsGeometry<Box<T>> : std::true_type {};
+
+			template<typename T> struct GeometryScalar;
+			template<typename T> struct GeometryScalar<Rectangle<T>> { using type = T; static constexpr uint32_t shape = 0x100; };
+			template<typename T> struct GeometryScalar<Padding<T>> { using type = T; static constexpr uint32_t shape = 0x200; };
+			template<typename T> struct GeometryScalar<Box<T>> { using type = T; static constexpr uint32_t shape = 0x300; };
+
+			inline constexpr uint32_t StringType = 0x400;
+
+			template<typename T>
+			constexpr uint32_t ScalarCode() {
+				uint32_t category = std::is_floating_point_v<T> ? 0x30 : (std::is_signed_v<T> ? 0x10 : 0x20);
+				return category | static_cast<uint32_t>(sizeof(T));
+			}
+
+			inline size_t Align8(size_t n) { return (n + 7) & ~size_t(7); }
+		}
+
+		template<typename T>
+		concept Fixed = (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || detail::IsGeometry<T>::value;
+
+		template<typename T>
+		concept Storable = Fixed<T> || std::same_as<T, std::string>;
+
+		template<Storable T>
+		constexpr uint32_t TypeCode() {
+			if constexpr (std::same_as<T, std::string>) return detail::StringType;
+			else if constexpr (detail::IsGeometry<T>::value) {
+				using G = detail::GeometryScalar<T>;
+				return G::shape | detail::ScalarCode<typename G::type>();
+			}
+			else return detail::ScalarCode<T>();
+		}
+
+		// What a view hands out per element: string_view for strings, a reference otherwise
+		template<Storable T>
+		using ElementRef = std::conditional_t<std::same_as<T, std::string>, std::string_view, const T&>;
+
+		// Column of elements inside a mapped snapshot
+		template<Storable T>
+		class ColumnView {
+		public:
+			ColumnView() = default;
+
+			size_t size() const { return m_count; }
+			bool empty() const { return m_count == 0; }
+
+			ElementRef<T> operator[](size_t i) const {
+				if constexpr (std::same_as<T, std::string>)
+					return std::string_view(m_blob + m_offsets[i], m_offsets[i + 1] - m_offsets[i]);
+				else
+					return m_data[i];
+			}
+
+			// Contiguous storage of a fixed-size column
+			std::span<const T> span() const requires Fixed<T> { return { m_data, m_count }; }
+
+		private:
+			template<Storable, Storable> friend class MapView;
+			friend class Reader;
+
+			// Validates one column starting at `p`, returns the byte past its end or nullptr on failure.
+			// count comes from the file, so it is checked against the bytes left before any size is computed from it.
+			const uint8_t* Bind(const uint8_t* p, const uint8_t* end, size_t count) {
+				m_count = count;
+				const size_t available = static_cast<size_t>(end - p);
+				if constexpr (std::same_as<T, std::string>) {
+					if (count >= available / sizeof(uint32_t)) return nullptr;	// count + 1 offsets
+					size_t tableBytes = detail::Align8((count + 1) * sizeof(uint32_t));
+					if (available < tableBytes) return nullptr;
+					m_offsets = reinterpret_cast<const uint32_t*>(p);
+					if (m_offsets[0] != 0) return nullptr;
+					for (size_t i = 0; i < count; ++i)
+						if (m_offsets[i + 1] < m_offsets[i]) return nullptr;
+					p += tableBytes;
+					size_t blobBytes = detail::Align8(m_offsets[count]);
+					if (static_cast<size_t>(end - p) < blobBytes) return nullptr;
+					m_blob = reinterpret_cast<const char*>(p);
+					return p + blobBytes;
+				}
+				else {
+					if (count > available / sizeof(T)) return nullptr;
+					size_t bytes = detail::Align8(count * sizeof(T));
+					if (available < bytes) return nullptr;
+					m_data = reinterpret_cast<const T*>(p);
+					return p + bytes;
+				}
+			}
+
+			size_t m_count = 0;
+			const T* m_data = nullptr;
+			const uint32_t* m_offsets = nullptr;
+			const char* m_blob = nullptr;
+		};
+
+		template<Storable T>
+		using ArrayView = ColumnView<T>;
+
+		// ordered_map stored as key column, value column and a key-sorted permutation for lookup.
+		// Iteration follows the original insertion order.
+		template<Storable K, Storable V>
+		class MapView {
+		public:
+			MapView() = default;
+
+			size_t size() const { return m_keys.size(); }
+			bool empty() const { return m_keys.empty(); }
+
+			ElementRef<K> key(size_t i) const { return m_keys[i]; }
+			ElementRef<V> value(size_t i) const { return m_values[i]; }
+			const ColumnView<K>& keys() const { return m_keys; }
+			const ColumnView<V>& values() const { return m_values; }
+
+			// Insertion-order index of `k`, or size() if absent
+			size_t index_of(ElementRef<K> k) const {
+				size_t lo = 0, hi = size();
+				while (lo < hi) {
+					size_t mid = lo + (hi - lo) / 2;
+					if (m_keys[m_order[mid]] < k) lo = mid + 1;
+					else hi = mid;
+				}
+				return (lo < size() && m_keys[m_order[lo]] == k) ? m_order[lo] : size();
+			}
+
+			bool contains(ElementRef<K> k) const { return index_of(k) != size(); }
+
+			const V* find(ElementRef<K> k) const requires Fixed<V> {
+				size_t i = index_of(k);
+				return i == size() ? nullptr : &m_values.span()[i];
+			}
+
+			ElementRef<V> at(ElementRef<K> k) const {
+				size_t i = index_of(k);
+				if (i == size())
+					throw std::out_of_range("Snapshot map key not found.");
+				return m_values[i];
+			}
+
+			ordered_map<K, V> to_ordered_map() const {
+				ordered_map<K, V> out;
+				for (size_t i = 0; i < size(); ++i)
+					out.push_back(K(m_keys[i]), V(m_values[i]));
+				return out;
+			}
+
+			template<typename Fn>
+			void for_each(Fn&& fn) const {
+				for (size_t i = 0; i < size(); ++i)
+					fn(m_keys[i], m_values[i]);
+			}
+
+		private:
+			friend class Reader;
+
+			bool Bind(const uint8_t* p, const uint8_t* end, size_t count) {
+				if (count > static_cast<size_t>(end - p) / sizeof(uint32_t)) return false;	// the order column alone needs this much
+				p = m_keys.Bind(p, end, count);
+				if (!p) return false;
+				p = m_values.Bind(p, end, count);
+				if (!p) return false;
+				if (count > static_cast<size_t>(end - p) / sizeof(uint32_t)) return false;
+				m_order = reinterpret_cast<const uint32_t*>(p);
+				for (size_t i = 0; i < count; ++i)
+					if (m_order[i] >= count) return false;
+				return true;
+			}
+
+			ColumnView<K> m_keys;
+			ColumnView<V> m_values;
+			const uint32_t* m_order = nullptr;
+		};
+
+		class Writer {
+		public:
+			template<Storable T>
+			void WriteArray(std::string_view name, std::span<const T> items) {
+				Section& s = AddSection(name, SectionKind::Array, 0, TypeCode<T>(), items.size());
+				AppendColumn<T>(s.payload, items.size(), [&](size_t i) -> const T& { return items[i]; });
+			}
+
+			template<Storable T>
+			void WriteArray(std::string_view name, const std::vector<T>& items) { WriteArray<T>(name, std::span<const T>(items)); }
+
+			template<Storable K, Storable V>
+				requires std::totally_ordered<K>
+			void WriteMap(std::string_view name, const ordered_map<K, V>& map) {
+				std::vector<const std::pair<K, V>*> entries;
+				entries.reserve(map.size());
+				for (const auto& kv : map)
+					entries.push_back(&kv);
+
+				Section& s = AddSection(name, SectionKind::Map, TypeCode<K>(), TypeCode<V>(), entries.size());
+				AppendColumn<K>(s.payload, entries.size(), [&](size_t i) -> const K& { return entries[i]->first; });
+				AppendColumn<V>(s.payload, entries.size(), [&](size_t i) -> const V& { return entries[i]->second; });
+
+				std::vector<uint32_t> order(entries.size());
+				for (size_t i = 0; i < order.size(); ++i)
+					order[i] = static_cast<uint32_t>(i);
+				std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return entries[a]->first < entries[b]->first; });
+				Append(s.payload, order.data(), order.size() * sizeof(uint32_t));
+			}
+
+			std::vector<uint8_t> Finish() const {
+				const size_t tableEnd = sizeof(Header) + m_sections.size() * sizeof(SectionEntry);
+				size_t total = detail::Align8(tableEnd);
+				for (const Section& s : m_sections)
+					total += detail::Align8(s.payload.size());
+
+				std::vector<uint8_t> out(total, 0);
+				Header header{};
+				std::memcpy(header.magic, Magic, sizeof(Magic));
+				header.version = Version;
+				header.endian = EndianMarker;
+				header.sectionCount = static_cast<uint32_t>(m_sections.size());
+				header.fileSize = total;
+				std::memcpy(out.data(), &header, sizeof(header));
+
+				size_t offset = detail::Align8(tableEnd);
+				for (size_t i = 0; i < m_sections.size(); ++i) {
+					SectionEntry entry = m_sections[i].entry;
+					entry.offset = offset;
+					entry.size = m_sections[i].payload.size();
+					std::memcpy(out.data() + sizeof(Header) + i * sizeof(SectionEntry), &entry, sizeof(entry));
+					std::memcpy(out.data() + offset, m_sections[i].payload.data(), m_sections[i].payload.size());
+					offset += detail::Align8(m_sections[i].payload.size());
+				}
+				return out;
+			}
+
+			void Save(const std::filesystem::path& path) const {
+				std::vector<uint8_t> data = Finish();
+				std::ofstream out(path, std::ios::binary | std::ios::trunc);
+				out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+				if (!out)
+					throw std::runtime_error("Failed to write snapshot: " + path.string());
+			}
+
+		private:
+			struct Section {
+				SectionEntry entry;
+				std::vector<uint8_t> payload;
+			};
+
+			Section& AddSection(std::string_view name, SectionKind kind, uint32_t keyType, uint32_t valueType, size_t count) {
+				if (name.empty() || name.size() > MaxNameLength)
+					throw std::invalid_argument("Snapshot section names must be 1-23 characters.");
+				if (count > (std::numeric_limits<uint32_t>::max)())
+					throw std::length_error("Snapshot section has too many elements.");
+				for (const Section& s : m_sections)
+					if (name == s.entry.name)
+						throw std::invalid_argument("Duplicate snapshot section: " + std::string(name));
+
+				Section& s = m_sections.emplace_back();
+				std::memcpy(s.entry.name, name.data(), name.size());
+				s.entry.kind = kind;
+				s.entry.keyType = keyType;
+				s.entry.valueType = valueType;
+				s.entry.count = count;
+				return s;
+			}
+
+			static void Append(std::vector<uint8_t>& out, const void* data, size_t bytes) {
+				const uint8_t* p = static_cast<const uint8_t*>(data);
+				out.insert(out.end(), p, p + bytes);
+				out.resize(detail::Align8(out.size()), 0);
+			}
+
+			template<Storable T, typename Get>
+			static void AppendColumn(std::vector<uint8_t>& out, size_t count, Get&& get) {
+				if constexpr (std::same_as<T, std::string>) {
+					std::vector<uint32_t> offsets(count + 1, 0);
+					size_t blobBytes = 0;
+					for (size_t i = 0; i < count; ++i) {
+						blobBytes += get(i).size();
+						if (blobBytes > (std::numeric_limits<uint32_t>::max)())
+							throw std::length_error("Snapshot string column exceeds 4 GiB.");
+						offsets[i + 1] = static_cast<uint32_t>(blobBytes);
+					}
+					Append(out, offsets.data(), offsets.size() * sizeof(uint32_t));
+					size_t start = out.size();
+					out.resize(start + blobBytes);
+					for (size_t i = 0; i < count; ++i) {
+						const std::string& str = get(i);
+						std::memcpy(out.data() + start + offsets[i], str.data(), str.size());
+					}
+					out.resize(detail::Align8(out.size()), 0);
+				}
+				else {
+					size_t start = out.size();
+					out.resize(start + count * sizeof(T));
+					for (size_t i = 0; i < count; ++i)
+						std::memcpy(out.data() + start + i * sizeof(T), &get(i), sizeof(T));
+					out.resize(detail::Align8(out.size()), 0);
+				}
+			}
+
+			std::vector<Section> m_sections;
+		};
+
+		// Validates a snapshot in place and hands out views into it. The buffer (or the mapped
+		// file when opened from a path) must outlive every view.
+		class Reader {
+		public:
+			Reader() = default;
+
+			explicit Reader(const std::filesystem::path& path) : m_file(path) {
+				Validate(m_file.Data(), m_file.Size());
+			}
+
+			Reader(const uint8_t* data, size_t size) { Validate(data, size); }
+
+			size_t GetSectionCount() const { return m_count; }
+			std::string_view GetSectionName(size_t i) const { return m_sections[i].name; }
+
+			bool Contains(std::string_view name) const { return FindSection(name) != nullptr; }
+
+			template<Storable T>
+			ArrayView<T> GetArray(std::string_view name) const {
+				const SectionEntry& entry = Require(name, SectionKind::Array, 0, TypeCode<T>());
+				ArrayView<T> view;
+				const uint8_t* begin = m_data + entry.offset;
+				if (!view.Bind(begin, begin + entry.size, static_cast<size_t>(entry.count)))
+					throw std::runtime_error("Corrupt snapshot section: " + std::string(name));
+				return view;
+			}
+
+			template<Storable K, Storable V>
+			MapView<K, V> GetMap(std::string_view name) const {
+				const SectionEntry& entry = Require(name, SectionKind::Map, TypeCode<K>(), TypeCode<V>());
+				MapView<K, V> view;
+				const uint8_t* begin = m_data + entry.offset;
+				if (!view.Bind(begin, begin + entry.size, static_cast<size_t>(entry.count)))
+					throw std::runtime_error("Corrupt snapshot section: " + std::string(name));
+				return view;
+			}
+
+		private:
+			void Validate(const uint8_t* data, size_t size) {
+				Header header{};
+				if (!data || size < sizeof(Header))
+					throw std::runtime_error("Snapshot is too small.");
+				std::memcpy(&header, data, sizeof(header));
+				if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+					throw std::runtime_error("Not a snapshot file.");
+				if (header.endian != EndianMarker)
+					throw std::runtime_error("Snapshot was written with a different byte order.");
+				if (header.version != Version)
+					throw std::runtime_error("Unsupported snapshot version " + std::to_string(header.version) + ".");
+				if (header.fileSize != size || header.sectionCount > (size - sizeof(Header)) / sizeof(SectionEntry))
+					throw std::runtime_error("Snapshot is truncated.");
+
+				m_sections = reinterpret_cast<const SectionEntry*>(data + sizeof(Header));
+				m_count = header.sectionCount;
+				const size_t payloadStart = sizeof(Header) + m_count * sizeof(SectionEntry);
+				for (size_t i = 0; i < m_count; ++i) {
+					const SectionEntry& s = m_sections[i];
+					if (s.name[MaxNameLength] != '\0' || s.offset % 8 != 0 || s.offset < payloadStart ||
+						s.offset > size || s.size > size - s.offset)
+						throw std::runtime_error("Snapshot section table is corrupt.");
+				}
+				m_data = data;
+			}
+
+			const SectionEntry* FindSection(std::string_view name) const {
+				for (size_t i = 0; i < m_count; ++i)
+					if (name == m_sections[i].name)
+						return &m_sections[i];
+				return nullptr;
+			}
+
+			const SectionEntry& Require(std::string_view name, SectionKind kind, uint32_t keyType, uint32_t valueType) const {
+				const SectionEntry* s = FindSection(name);
+				if (!s)
+					throw std::out_of_range("Snapshot section not found: " + std::string(name));
+				if (s->kind != kind || s->keyType != keyType || s->valueType != valueType)
+					throw std::runtime_error("Snapshot section type mismatch: " + std::string(name));
+				return *s;
+			}
+
+			MappedFile m_file;
+			const uint8_t* m_data = nullptr;
+			const SectionEntry* m_sections = nullptr;
+			size_t m_count = 0;
+		};
+	}
+
+	struct FrameArenaStats {
+		uint64_t frame = 0;
+		size_t frameBytes = 0;			// bytes handed out by the arena this frame
+		size_t lastFrameBytes = 0;
+		size_t highWaterBytes = 0;		// largest frame so far, including fallbacks
+		size_t frameFallbacks = 0;		// allocations that did not fit and went to the upstream resource
+		size_t totalFallbacks = 0;
+		size_t totalFallbackBytes = 0;
+		size_t growths = 0;
+	};
+
+	// Double-buffered linear allocator for per-frame temporaries. NextFrame() switches buffers and
+	// resets the one being reused, so memory handed out in frame N stays valid through frame N + 1.
+	// Requests that do not fit go to the upstream resource and are released at that buffer's next reset,
+	// which also grows the buffer to cover the frame; after a warm-up frame steady state needs no heap.
+	class FrameArena : public std::pmr::memory_resource {
+	public:
+		explicit FrameArena(size_t capacity = 1 << 20, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+			: m_upstream(upstream)
+		{
+			for (Buffer& b : m_buffers) {
+				Resize(b, capacity);
+				b.fallbacks.reserve(64);
+			}
+		}
+
+		~FrameArena() override {
+			for (Buffer& b : m_buffers) {
+				Release(b);
+				if (b.data)
+					::operator delete(b.data, std::align_val_t{ BufferAlignment });
+			}
+		}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		void NextFrame() {
+			m_stats.lastFrameBytes = m_stats.frameBytes;
+			m_stats.frameBytes = 0;
+			m_stats.frameFallbacks = 0;
+			++m_stats.frame;
+
+			m_current ^= 1;
+			Reset(m_buffers[m_current]);
+		}
+
+		// Takes effect for each buffer at its next reset
+		void Reserve(size_t capacity) { m_minCapacity = std::max(m_minCapacity, capacity); }
+
+		size_t GetCapacity() const { return m_buffers[m_current].capacity; }
+		const FrameArenaStats& GetStats() const { return m_stats; }
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			Buffer& b = m_buffers[m_current];
+			const size_t aligned = (b.used + alignment - 1) & ~(alignment - 1);
+			if (alignment <= BufferAlignment && aligned + bytes <= b.capacity) {
+				b.used = aligned + bytes;
+				Track(bytes);
+				return b.data + aligned;
+			}
+
+			void* p = m_upstream->allocate(bytes, alignment);
+			b.fallbacks.push_back({ p, bytes, alignment });
+			b.overflow += bytes + alignment;
+			++m_stats.frameFallbacks;
+			++m_stats.totalFallbacks;
+			m_stats.totalFallbackBytes += bytes;
+			Track(bytes);
+			return p;
+		}
+
+		void do_deallocate(void*, size_t, size_t) override {}	// released in bulk on reset
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	private:
+		static constexpr size_t BufferAlignment = 64;
+
+		struct Fallback {
+			void* ptr;
+			size_t bytes;
+			size_t alignment;
+		};
+
+		struct Buffer {
+			std::byte* data = nullptr;
+			size_t capacity = 0;
+			size_t used = 0;
+			size_t overflow = 0;
+			std::vector<Fallback> fallbacks;
+		};
+
+		void Track(size_t bytes) {
+			m_stats.frameBytes += bytes;
+			m_stats.highWaterBytes = std::max(m_stats.highWaterBytes, m_stats.frameBytes);
+		}
+
+		void Release(Buffer& b) {
+			for (const Fallback& f : b.fallbacks)
+				m_upstream->deallocate(f.ptr, f.bytes, f.alignment);
+			b.fallbacks.clear();
+		}
+
+		void Reset(Buffer& b) {
+			Release(b);
+			size_t required = std::max(b.used + b.overflow, m_minCapacity);
+			if (required > b.capacity) {
+				size_t capacity = b.capacity ? b.capacity : BufferAlignment;
+				while (capacity < required)
+					capacity *= 2;
+				Resize(b, capacity);
+				++m_stats.growths;
+			}
+			b.used = 0;
+			b.overflow = 0;
+		}
+
+		static void Resize(Buffer& b, size_t capacity) {
+			if (b.data)
+				::operator delete(b.data, std::align_val_t{ BufferAlignment });
+			b.data = capacity ? static_cast<std::byte*>(::operator new(capacity, std::align_val_t{ BufferAlignment })) : nullptr;
+			b.capacity = capacity;
+		}
+
+		std::pmr::memory_resource* m_upstream;
+		Buffer m_buffers[2];
+		int m_current = 0;
+		size_t m_minCapacity = 0;
+		FrameArenaStats m_stats{};
+	};
+
+	// One frame of input as seen by the application: held keys and buttons, pointer, wheel,
+	// typed characters and the frame delta. Pressed/released edges are derived from the previous frame.
+	struct InputFrame {
+		static constexpr int KeyCount = 512;
+		static constexpr int ButtonCount = 8;
+		static constexpr int MaxChars = 16;
+
+		std::bitset<KeyCount> keys;
+		uint8_t buttons = 0;
+		Vector2 mouse{ 0.0f, 0.0f };
+		Vector2 wheel{ 0.0f, 0.0f };
+		float dt = 0.0f;
+		uint8_t charCount = 0;
+		int chars[MaxChars] = {};
+
+		bool IsKeyDown(int key) const { return key >= 0 && key < KeyCount && keys[key]; }
+		bool IsButtonDown(int button) const { return button >= 0 && button < ButtonCount && (buttons >> button) & 1; }
+
+		bool operator==(const InputFrame& o) const {
+			return keys == o.keys && buttons == o.buttons && mouse.x == o.mouse.x && mouse.y == o.mouse.y &&
+				wheel.x == o.wheel.x && wheel.y == o.wheel.y && dt == o.dt && charCount == o.charCount &&
+				std::equal(chars, chars + charCount, o.chars);
+		}
+	};
+
+	// Recorded sequence of InputFrames. On disk every frame stores only what changed since the previous one:
+	// a flag byte, then toggled key codes, buttons, mouse, wheel, characters and dt as present.
+	// An idle frame at a steady frame rate costs one byte.
+	class InputLog {
+	public:
+		static constexpr char Magic[4] = { 'R', 'L', 'X', 'I' };
+		static constexpr uint32_t Version = 1;
+
+		void Append(const InputFrame& frame) { m_frames.push_back(frame); }
+		void Clear() { m_frames.clear(); }
+		void Reserve(size_t frames) { m_frames.reserve(frames); }
+
+		size_t size() const { return m_frames.size(); }
+		bool empty() const { return m_frames.empty(); }
+		const InputFrame& operator[](size_t i) const { return m_frames[i]; }
+		const std::vector<InputFrame>& GetFrames() const { return m_frames; }
+
+		// Sum of recorded frame deltas in seconds
+		double GetDuration() const {
+			double total = 0.0;
+			for (const InputFrame& f : m_frames)
+				total += f.dt;
+			return total;
+		}
+
+		std::vector<uint8_t> Encode() const {
+			std::vector<uint8_t> out;
+			out.reserve(16 + m_frames.size() * 2);
+			Put(out, Magic, sizeof(Magic));
+			PutValue(out, Version);
+			PutValue(out, static_cast<uint32_t>(m_frames.size()));
+
+			InputFrame prev{};
+			std::vector<uint16_t> toggled;
+			for (const InputFrame& f : m_frames) {
+				const std::bitset<InputFrame::KeyCount> diff = f.keys ^ prev.keys;
+				uint8_t flags = 0;
+				if (diff.any()) flags |= KeysChanged;
+				if (f.buttons != prev.buttons) flags |= ButtonsChanged;
+				if (f.mouse.x != prev.mouse.x || f.mouse.y != prev.mouse.y) flags |= MouseChanged;
+				if (f.wheel.x != 0.0f || f.wheel.y != 0.0f) flags |= HasWheel;
+				if (f.charCount > 0) flags |= HasChars;
+				if (f.dt != prev.dt) flags |= DtChanged;
+				out.push_back(flags);
+
+				if (flags & KeysChanged) {
+					toggled.clear();
+					for (int k = 0; k < InputFrame::KeyCount; ++k)
+						if (diff[k]) toggled.push_back(static_cast<uint16_t>(k));
+					PutValue(out, static_cast<uint16_t>(toggled.size()));
+					Put(out, toggled.data(), toggled.size() * sizeof(uint16_t));
+				}
+				if (flags & ButtonsChanged) out.push_back(f.buttons);
+				if (flags & MouseChanged) PutValue(out, f.mouse);
+				if (flags & HasWheel) PutValue(out, f.wheel);
+				if (flags & HasChars) {
+					out.push_back(f.charCount);
+					Put(out, f.chars, f.charCount * sizeof(int));
+				}
+				if (flags & DtChanged) PutValue(out, f.dt);
+				prev = f;
+			}
+			return out;
+		}
+
+		static InputLog Decode(const uint8_t* data, size_t size) {
+			Cursor in{ data, data + size };
+			char magic[4];
+			uint32_t version = 0, count = 0;
+			if (!in.Read(magic, sizeof(magic)) || std::memcmp(magic, Magic, sizeof(Magic)) != 0)
+				throw std::runtime_error("Not an input log.");
+			if (!in.ReadValue(version) || version != Version)
+				throw std::runtime_error("Unsupported input log version " + std::to_string(version) + ".");
+			if (!in.ReadValue(count) || count > size)
+				throw std::runtime_error("Input log is truncated.");
+
+			InputLog log;
+			log.m_frames.reserve(count);
+			InputFrame prev{};
+			for (uint32_t i = 0; i < count; ++i) {
+				InputFrame f = prev;
+				f.wheel = { 0.0f, 0.0f };
+				f.charCount = 0;
+				uint8_t flags = 0;
+				bool ok = in.ReadValue(flags);
+				if (ok && (flags & KeysChanged)) {
+					uint16_t n = 0;
+					ok = in.ReadValue(n);
+					for (uint16_t k = 0; ok && k < n; ++k) {
+						uint16_t key = 0;
+						ok = in.ReadValue(key) && key < InputFrame::KeyCount;
+						if (ok) f.keys.flip(key);
+					}
+				}
+				if (ok && (flags & ButtonsChanged)) ok = in.ReadValue(f.buttons);
+				if (ok && (flags & MouseChanged)) ok = in.ReadValue(f.mouse);
+				if (ok && (flags & HasWheel)) ok = in.ReadValue(f.wheel);
+				if (ok && (flags & HasChars)) {
+					ok = in.ReadValue(f.charCount) && f.charCount <= InputFrame::MaxChars &&
+						in.Read(f.chars, f.charCount * sizeof(int));
+				}
+				if (ok && (flags & DtChanged)) ok = in.ReadValue(f.dt);
+				if (!ok)
+					throw std::runtime_error("Input log is corrupt at frame " + std::to_string(i) + ".");
+				log.m_frames.push_back(f);
+				prev = f;
+			}
+			return log;
+		}
+
+		void Save(const std::filesystem::path& path) const {
+			const std::vector<uint8_t> bytes = Encode();
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+				throw std::runtime_error("Failed to write input log: " + path.string());
+		}
+
+		static InputLog Load(const std::filesystem::path& path) {
+			MappedFile file(path);
+			return Decode(file.Data(), file.Size());
+		}
+
+	private:
+		enum : uint8_t {
+			KeysChanged = 1 << 0,
+			ButtonsChanged = 1 << 1,
+			MouseChanged = 1 << 2,
+			HasWheel = 1 << 3,
+			HasChars = 1 << 4,
+			DtChanged = 1 << 5,
+		};
+
+		struct Cursor {
+			const uint8_t* p;
+			const uint8_t* end;
+
+			bool Read(void* dst, size_t bytes) {
+				if (static_cast<size_t>(end - p) < bytes) return false;
+				std::memcpy(dst, p, bytes);
+				p += bytes;
+				return true;
+			}
+
+			template<typename T>
+			bool ReadValue(T& value) { return Read(&value, sizeof(T)); }
+		};
+
+		static void Put(std::vector<uint8_t>& out, const void* src, size_t bytes) {
+			const uint8_t* b = static_cast<const uint8_t*>(src);
+			out.insert(out.end(), b, b + bytes);
+		}
+
+		template<typename T>
+		static void PutValue(std::vector<uint8_t>& out, const T& value) { Put(out, &value, sizeof(T)); }
+
+		std::vector<InputFrame> m_frames;
+	};
+
+	// Input facade over raylib polling. BeginFrame() captures one InputFrame per frame, either from the
+	// live devices (optionally appending it to a recording) or from a replayed InputLog; queries then read
+	// that frame only. Code that reads input and frame time through here instead of raylib directly
+	// behaves identically on replay.
+	class Input {
+	public:
+		enum class Mode { Live, Record, Replay };
+
+		static void BeginFrame() { BeginFrame(::GetFrameTime()); }
+
+		// Live and recorded frames take frameTime as their delta, for loops that measure it themselves
+		static void BeginFrame(float frameTime) {
+			Input& in = Instance();
+			in.m_previous = in.m_current;
+			in.m_charRead = 0;
+			in.m_captured = true;
+			if (in.m_mode == Mode::Replay) {
+				if (in.m_cursor < in.m_replay.size())
+					in.m_current = in.m_replay[in.m_cursor++];
+				else {
+					in.m_current.wheel = { 0.0f, 0.0f };
+					in.m_current.charCount = 0;
+					in.m_finished = true;
+				}
+				return;
+			}
+			Capture(in.m_current, in.m_mode == Mode::Record);
+			in.m_current.dt = frameTime;
+			if (in.m_mode == Mode::Record)
+				in.m_recording.Append(in.m_current);
+		}
+
+		static void StartRecording(size_t expectedFrames = 0) {
+			Input& in = Instance();
+			in.m_recording.Clear();
+			in.m_recording.Reserve(expectedFrames);
+			in.m_mode = Mode::Record;
+		}
+
+		// Returns the frames captured since StartRecording() and switches back to live input
+		static InputLog StopRecording() {
+			Input& in = Instance();
+			in.m_mode = Mode::Live;
+			return std::exchange(in.m_recording, InputLog{});
+		}
+
+		static void StartReplay(InputLog log) {
+			Input& in = Instance();
+			in.m_replay = std::move(log);
+			in.m_cursor = 0;
+			in.m_finished = false;
+			in.m_current = in.m_previous = InputFrame{};
+			in.m_mode = Mode::Replay;
+		}
+
+		static void StopReplay() {
+			Input& in = Instance();
+			in.m_replay.Clear();
+			in.m_finished = false;
+			in.m_mode = Mode::Live;
+		}
+
+		static Mode GetMode() { return Instance().m_mode; }
+		static bool IsReplaying() { return Instance().m_mode == Mode::Replay; }
+		// True once BeginFrame() was called with no recorded frames left
+		static bool IsReplayFinished() { return Instance().m_finished; }
+		static size_t GetReplayPosition() { return Instance().m_cursor; }
+
+		static bool IsKeyDown(int key) { return Instance().m_current.IsKeyDown(key); }
+		static bool IsKeyUp(int key) { return !IsKeyDown(key); }
+		static bool IsKeyPressed(int key) { return IsKeyDown(key) && !Instance().m_previous.IsKeyDown(key); }
+		static bool IsKeyReleased(int key) { return !IsKeyDown(key) && Instance().m_previous.IsKeyDown(key); }
+
+		static bool IsMouseButtonDown(int button) { return Instance().m_current.IsButtonDown(button); }
+		static bool IsMouseButtonUp(int button) { return !IsMouseButtonDown(button); }
+		static bool IsMouseButtonPressed(int button) { return IsMouseButtonDown(button) && !Instance().m_previous.IsButtonDown(button); }
+		static bool IsMouseButtonReleased(int button) { return !IsMouseButtonDown(button) && Instance().m_previous.IsButtonDown(button); }
+
+		static Vector2 GetMousePosition() { return Instance().m_current.mouse; }
+		static Vector2 GetMouseDelta() {
+			const Input& in = Instance();
+			return { in.m_current.mouse.x - in.m_previous.mouse.x, in.m_current.mouse.y - in.m_previous.mouse.y };
+		}
+		static Vector2 GetMouseWheelMoveV() { return Instance().m_current.wheel; }
+		static float GetMouseWheelMove() {
+			const Vector2 w = Instance().m_current.wheel;
+			return std::fabs(w.x) > std::fabs(w.y) ? w.x : w.y;
+		}
+
+		// Next character typed this frame, 0 when the queue is empty. Live input reads raylib's queue directly,
+		// so code calling ::GetCharPressed() keeps working; only recording and replay take the queue over.
+		static int GetCharPressed() {
+			Input& in = Instance();
+			if (in.m_mode == Mode::Live)
+				return ::GetCharPressed();
+			return in.m_charRead < in.m_current.charCount ? in.m_current.chars[in.m_charRead++] : 0;
+		}
+
+		// Delta of the current frame; raylib's frame time for loops that never call BeginFrame()
+		static float GetFrameTime() {
+			const Input& in = Instance();
+			return in.m_captured ? in.m_current.dt : ::GetFrameTime();
+		}
+		static const InputFrame& GetFrame() { return Instance().m_current; }
+
+	private:
+		// Characters are drained from raylib's queue only when recording; at most MaxChars per frame are kept
+		static void Capture(InputFrame& f, bool takeChars) {
+			f.keys.reset();
+			for (int k = 0; k < InputFrame::KeyCount; ++k)
+				if (::IsKeyDown(k)) f.keys.set(k);
+			f.buttons = 0;
+			for (int b = 0; b < InputFrame::ButtonCount; ++b)
+				if (::IsMouseButtonDown(b)) f.buttons |= static_cast<uint8_t>(1 << b);
+			f.mouse = ::GetMousePosition();
+			f.wheel = ::GetMouseWheelMoveV();
+			f.charCount = 0;
+			while (takeChars && f.charCount < InputFrame::MaxChars) {
+				const int c = ::GetCharPressed();
+				if (c == 0) break;
+				f.chars[f.charCount++] = c;
+			}
+		}
+
+		static Input& Instance() {
+			static Input instance;
+			return instance;
+		}
+
+		Mode m_mode = Mode::Live;
+		InputFrame m_current{};
+		InputFrame m_previous{};
+		int m_charRead = 0;
+		InputLog m_recording;
+		InputLog m_replay;
+		size_t m_cursor = 0;
+		bool m_finished = false;
+		bool m_captured = false;
+	};
+
+	struct ReplayFrameTiming {
+		float dt = 0.0f;				// recorded frame delta fed to the layers
+		uint64_t updateNs = 0;
+		uint64_t renderNs = 0;			// 0 when the replay does not render
+	};
+
+	struct ReplayOptions {
+		bool render = true;				// false runs OnUpdate only and needs no window or GPU
+		std::string name = "replay";	// prefix of the benchmark names in the timings file
+		std::filesystem::path timingsPath;	// rlx-bench/1 JSON written after the run when set
+	};
+
+	struct ReplayReport {
+		std::string name;
+		std::vector<ReplayFrameTiming> frames;
+		uint64_t wallNs = 0;
+
+		struct Summary {
+			double mean = 0.0, min = 0.0, p50 = 0.0, p95 = 0.0, p99 = 0.0, max = 0.0;
+		};
+
+		// Nanosecond statistics over one field of every frame
+		Summary Summarize(uint64_t ReplayFrameTiming::* field) const {
+			Summary s;
+			if (frames.empty())
+				return s;
+			std::vector<uint64_t> values;
+			values.reserve(frames.size());
+			double total = 0.0;
+			for (const ReplayFrameTiming& f : frames) {
+				values.push_back(f.*field);
+				total += static_cast<double>(f.*field);
+			}
+			std::sort(values.begin(), values.end());
+			auto at = [&](double q) { return static_cast<double>(values[static_cast<size_t>(q * (values.size() - 1) + 0.5)]); };
+			s.mean = total / values.size();
+			s.min = static_cast<double>(values.front());
+			s.p50 = at(0.50);
+			s.p95 = at(0.95);
+			s.p99 = at(0.99);
+			s.max = static_cast<double>(values.back());
+			return s;
+		}
+
+		// Writes the summary in the rlx-bench/1 schema read by tools/compare_bench.py, keyed on frame count,
+		// followed by the raw per-frame timings
+		void Save(const std::filesystem::path& path) const {
+			char date[32];
+			const std::time_t now = std::time(nullptr);
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+			std::ofstream json(path, std::ios::trunc);
+			json << "{\n  \"schema\": \"rlx-bench/1\",\n";
+			json << "  \"context\": { \"date\": \"" << date << "\", \"threads\": " << std::thread::hardware_concurrency()
+				<< ", \"quick\": false, \"replay_frames\": " << frames.size() << ", \"wall_ns\": " << wallNs << " },\n";
+			json << "  \"results\": [\n";
+			const std::pair<const char*, uint64_t ReplayFrameTiming::*> fields[] = {
+				{ "update", &ReplayFrameTiming::updateNs }, { "render", &ReplayFrameTiming::renderNs } };
+			bool first = true;
+			for (const auto& [label, field] : fields) {
+				const Summary s = Summarize(field);
+				const std::pair<const char*, double> stats[] = { { "", s.mean }, { "_p50", s.p50 }, { "_p95", s.p95 }, { "_p99", s.p99 }, { "_max", s.max } };
+				for (const auto& [suffix, value] : stats) {
+					json << (first ? "" : ",\n") << "    { \"name\": \"" << name << '/' << label << suffix << "\", \"size\": " << frames.size()
+						<< ", \"iterations\": " << frames.size() << ", \"ns_per_op\": " << value << ", \"ns_per_op_min\": " << s.min << " }";
+					first = false;
+				}
+			}
+			json << "\n  ],\n  \"frames\": [\n";
+			for (size_t i = 0; i < frames.size(); ++i) {
+				json << "    { \"dt\": " << frames[i].dt << ", \"update_ns\": " << frames[i].updateNs
+					<< ", \"render_ns\": " << frames[i].renderNs << " }" << (i + 1 < frames.size() ? ",\n" : "\n");
+			}
+			json << "  ]\n}\n";
+			if (!json)
+				throw std::runtime_error("Failed to write replay timings: " + path.string());
+		}
+	};
+
+	// Time source for FramePacer; tests substitute a scripted clock
+	class FrameClock {
+	public:
+		virtual ~FrameClock() = default;
+		virtual double Now() = 0;					// monotonic seconds
+		virtual void Sleep(double seconds) = 0;		// may return late
+		virtual void Relax() {}						// one busy-wait step
+	};
+
+	class SystemFrameClock final : public FrameClock {
+	public:
+		double Now() override {
+			return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		void Sleep(double seconds) override {
+			std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+		}
+
+		void Relax() override {
+#ifdef RLX_SSE2
+			_mm_pause();
+#else
+			std::this_thread::yield();
+#endif
+		}
+
+		static SystemFrameClock& Instance() {
+			static SystemFrameClock instance;
+			return instance;
+		}
+	};
+
+	struct FramePacerStats {
+		uint64_t frames = 0;
+		uint64_t missedDeadlines = 0;	// presents later than the deadline plus MissTolerance
+		double lastFrameTime = 0.0;		// seconds between the last two presents
+		double meanFrameTime = 0.0;
+		double frameTimeVariance = 0.0;
+		double minFrameTime = 0.0;
+		double maxFrameTime = 0.0;
+		double lastWorkTime = 0.0;		// BeginFrame() returning to EndFrame()
+		double workEstimate = 0.0;		// what just-in-time frames budget for the work
+		double sleepOvershoot = 0.0;	// how late Sleep() is currently expected to return
+		double lastInputLatency = 0.0;	// BeginFrame() returning (input sampled) to present
+		double spinTime = 0.0;			// total busy-waiting
+
+		double FrameTimeStdDev() const { return std::sqrt(frameTimeVariance); }
+	};
+
+	// Paces frames to a fixed target. Waits sleep until the expected sleep overshoot plus a small headroom
+	// before the deadline and spin the rest, with the overshoot learned from every sleep, so the OS timer
+	// granularity does not show up as frame-time variance.
+	//   Hybrid:     EndFrame() waits for the deadline.
+	//   JustInTime: BeginFrame() also waits until the deadline minus the expected work, so input is sampled
+	//               as late as possible. Only useful when input polling and buffer swaps are under the
+	//               caller's control.
+	//   Off:        no waiting; frame times and missed deadlines are still tracked.
+	class FramePacer {
+	public:
+		enum class Mode { Off, Hybrid, JustInTime };
+
+		static constexpr double MissTolerance = 0.0005;
+		static constexpr double SpinHeadroom = 0.0002;
+
+		explicit FramePacer(FrameClock* clock = nullptr)
+			: m_clock(clock ? clock : &SystemFrameClock::Instance()) {
+		}
+
+		void SetMode(Mode mode) { m_mode = mode; }
+		Mode GetMode() const { return m_mode; }
+
+		// 0 or less paces nothing
+		void SetTargetFPS(double fps) { SetTargetFrameTime(fps > 0.0 ? 1.0 / fps : 0.0); }
+		void SetTargetFrameTime(double seconds) {
+			m_target = std::max(0.0, seconds);
+			m_started = false;
+		}
+		double GetTargetFrameTime() const { return m_target; }
+
+		// Extra margin just-in-time frames leave on top of the work estimate
+		void SetJustInTimeHeadroom(double seconds) { m_headroom = std::max(0.0, seconds); }
+		double GetJustInTimeHeadroom() const { return m_headroom; }
+
+		void SetClock(FrameClock* clock) {
+			m_clock = clock ? clock : &SystemFrameClock::Instance();
+			m_started = false;
+		}
+
+		// Measures the sleep overshoot up front instead of learning it over the first frames
+		void Calibrate(int samples = 10, double sleepSeconds = 0.001) {
+			for (int i = 0; i < samples; ++i) {
+				const double before = m_clock->Now();
+				m_clock->Sleep(sleepSeconds);
+				TrackOvershoot(m_clock->Now() - before - sleepSeconds);
+			}
+		}
+
+		// Starts the next frame from now instead of the old schedule, e.g. after a stall or a pause
+		void Resync() { m_started = false; }
+
+		void ResetStats() {
+			const double overshoot = m_stats.sleepOvershoot;
+			const double work = m_stats.workEstimate;
+			m_stats = FramePacerStats{};
+			m_stats.sleepOvershoot = overshoot;
+			m_stats.workEstimate = work;
+		}
+
+		const FramePacerStats& GetStats() const { return m_stats; }
+
+		// Seconds between the last two presents, or the target before any frame was presented
+		float GetFrameTime() const {
+			return static_cast<float>(m_stats.frames > 0 ? m_stats.lastFrameTime : m_target);
+		}
+
+		// Call before sampling input
+		void BeginFrame() {
+			if (!m_started) {
+				m_lastPresent = m_clock->Now();
+				m_deadline = m_lastPresent + m_target;
+				m_started = true;
+			}
+			if (m_mode == Mode::JustInTime && m_target > 0.0)
+				WaitUntil(m_deadline - m_stats.workEstimate - m_headroom);
+			m_inputTime = m_clock->Now();
+		}
+
+		// Call once the frame is submitted; returns at the point the frame should be presented
+		void EndFrame() {
+			const double workDone = m_clock->Now();
+			const double work = workDone - m_inputTime;
+			m_stats.lastWorkTime = work;
+			if (work > m_stats.workEstimate) m_stats.workEstimate = work;
+			else m_stats.workEstimate += (work - m_stats.workEstimate) * 0.1;
+
+			if (m_mode != Mode::Off && m_target > 0.0)
+				WaitUntil(m_deadline);
+
+			const double present = m_clock->Now();
+			const bool missed = m_target > 0.0 && present > m_deadline + MissTolerance;
+			if (missed)
+				++m_stats.missedDeadlines;
+			m_stats.lastInputLatency = present - m_inputTime;
+			Record(present - m_lastPresent);
+			m_lastPresent = present;
+
+			// After a miss, drop to the first deadline on the old phase that is a whole frame away, like
+			// vsync does, rather than rushing the next frames to catch up
+			m_deadline += m_target;
+			if (missed && present + m_target > m_deadline)
+				m_deadline += std::ceil((present + m_target - m_deadline) / m_target) * m_target;
+		}
+
+	private:
+		void WaitUntil(double time) {
+			double remaining = time - m_clock->Now();
+			if (remaining <= 0.0)
+				return;
+			const double margin = m_stats.sleepOvershoot + SpinHeadroom;
+			if (remaining > margin) {
+				const double request = remaining - margin;
+				const double before = m_clock->Now();
+				m_clock->Sleep(request);
+				TrackOvershoot(m_clock->Now() - before - request);
+			}
+			const double spinStart = m_clock->Now();
+			while (m_clock->Now() < time)
+				m_clock->Relax();
+			m_stats.spinTime += m_clock->Now() - spinStart;
+		}
+
+		// Jumps to a new worst case at once and decays slowly, so one lucky sleep does not cause a miss
+		void TrackOvershoot(double overshoot) {
+			overshoot = std::max(0.0, overshoot);
+			if (overshoot > m_stats.sleepOvershoot) m_stats.sleepOvershoot = overshoot;
+			else m_stats.sleepOvershoot += (overshoot - m_stats.sleepOvershoot) * 0.05;
+		}
+
+		void Record(double frameTime) {
+			FramePacerStats& s = m_stats;
+			s.lastFrameTime = frameTime;
+			++s.frames;
+			if (s.frames == 1) {
+				s.meanFrameTime = s.minFrameTime = s.maxFrameTime = frameTime;
+				s.frameTimeVariance = 0.0;
+				m_m2 = 0.0;
+				return;
+			}
+			const double delta = frameTime - s.meanFrameTime;
+			s.meanFrameTime += delta / static_cast<double>(s.frames);
+			m_m2 += delta * (frameTime - s.meanFrameTime);
+			s.frameTimeVariance = m_m2 / static_cast<double>(s.frames - 1);
+			s.minFrameTime = std::min(s.minFrameTime, frameTime);
+			s.maxFrameTime = std::max(s.maxFrameTime, frameTime);
+		}
+
+		FrameClock* m_clock;
+		Mode m_mode = Mode::Off;
+		double m_target = 0.0;
+		double m_headroom = 0.001;
+		bool m_started = false;
+		double m_deadline = 0.0;
+		double m_lastPresent = 0.0;
+		double m_inputTime = 0.0;
+		double m_m2 = 0.0;
+		FramePacerStats m_stats{ .sleepOvershoot = 0.001 };
+	};
+}
+namespace Core
+{
+	class Layer {
+	public:
+		Layer() = default;
+		virtual ~Layer() = default;
+		virtual void OnShow() {}
+		virtual void OnUpdate() = 0;
+		virtual void OnRender() = 0;
+		virtual void OnRender_Before_Unscaled() {}
+		virtual void OnRender_After_Unscaled() {}
+
+		std::string Identifier = "";
+
+		// Per-frame scratch memory, valid until the end of the next frame. Set by Application::Add.
+		std::pmr::memory_resource* FrameMemory = std::pmr::get_default_resource();
+	};
+
+	// Generation-checked entity handle
+	struct Entity {
+		uint32_t index = std::numeric_limits<uint32_t>::max();
+		uint32_t generation = 0;
+
+		constexpr bool IsNull() const { return index == std::numeric_limits<uint32_t>::max(); }
+		constexpr bool operator==(const Entity&) const = default;
+	};
+
+	// Entity-component store. Entities with the same component set share an archetype whose rows live in
+	// fixed-size chunks, one contiguous column per component. Views walk those columns directly.
+	// Structural changes (Create/Destroy/Add/Remove) are not allowed while iterating.
+	class Registry {
+	public:
+		static constexpr size_t MaxComponents = 64;
+		static constexpr size_t ChunkBytes = 16 * 1024;
+
+		Registry() {
+			GetArchetype(0);	// empty component set
+		}
+
+		~Registry() { Clear(); }
+
+		Registry(const Registry&) = delete;
+		Registry& operator=(const Registry&) = delete;
+
+		// --- Entities ---
+		template<typename... Cs>
+		Entity Create(Cs&&... components) {
+			static_assert(AllUnique<std::decay_t<Cs>...>(), "Duplicate component type in Create().");
+			uint64_t mask = (uint64_t(0) | ... | Bit<std::decay_t<Cs>>());
+			Archetype& arch = GetArchetype(mask);
+
+			Entity entity = AllocateEntity();
+			uint32_t row = AppendRow(arch, entity);
+			(Construct<std::decay_t<Cs>>(arch, row, std::forward<Cs>(components)), ...);
+			m_records[entity.index].archetype = arch.id;
+			m_records[entity.index].row = row;
+			return entity;
+		}
+
+		void Destroy(Entity entity) {
+			if (!IsAlive(entity)) return;
+			Record& record = m_records[entity.index];
+			RemoveRow(*m_archetypes[record.archetype], record.row, true);
+			record.archetype = InvalidArchetype;
+			++record.generation;
+			m_free.push_back(entity.index);
+			--m_alive;
+		}
+
+		bool IsAlive(Entity entity) const {
+			return entity.index < m_records.size() &&
+				m_records[entity.index].generation == entity.generation &&
+				m_records[entity.index].archetype != InvalidArchetype;
+		}
+
+		size_t Size() const { return m_alive; }
+
+		void Clear() {
+			for (auto& arch : m_archetypes) {
+				while (arch->count > 0)
+					RemoveRow(*arch, arch->count - 1, true);
+				while (!arch->chunks.empty())
+					FreeChunk(*arch);
+			}
+			for (size_t i = 0; i < m_records.size(); ++i) {
+				if (m_records[i].archetype != InvalidArchetype) {
+					m_records[i].archetype = InvalidArchetype;
+					++m_records[i].generation;
+					m_free.push_back(static_cast<uint32_t>(i));
+				}
+			}
+			m_alive = 0;
+		}
+
+		// --- Components ---
+		template<typename C>
+		bool Has(Entity entity) const {
+			return IsAlive(entity) && (m_archetypes[m_records[entity.index].archetype]->mask & Bit<C>()) != 0;
+		}
+
+		// Null when the entity is dead or lacks the component
+		template<typename C>
+		C* Get(Entity entity) {
+			if (!Has<C>(entity)) return nullptr;
+			const Record& record = m_records[entity.index];
+			Archetype& arch = *m_archetypes[record.archetype];
+			return static_cast<C*>(Slot(arch, arch.columnOf[TypeId<C>()], record.row));
+		}
+
+		template<typename C, typename... Args>
+		C& Add(Entity entity, Args&&... args) {
+			if (!IsAlive(entity))
+				throw std::invalid_argument("Registry::Add on a dead entity.");
+			if (C* existing = Get<C>(entity)) {
+				*existing = C(std::forward<Args>(args)...);
+				return *existing;
+			}
+
+			Record& record = m_records[entity.index];
+			Archetype& from = *m_archetypes[record.archetype];
+			Archetype& to = GetArchetype(from.mask | Bit<C>());
+			uint32_t row = Migrate(entity, from, to);
+			Construct<C>(to, row, std::forward<Args>(args)...);
+			return *static_cast<C*>(Slot(to, to.columnOf[TypeId<C>()], row));
+		}
+
+		template<typename C>
+		void Remove(Entity entity) {
+			if (!Has<C>(entity)) return;
+			Record& record = m_records[entity.index];
+			Archetype& from = *m_archetypes[record.archetype];
+			Archetype& to = GetArchetype(from.mask & ~Bit<C>());
+			Migrate(entity, from, to);
+		}
+
+		// --- Views ---
+		// fn(Entity, Cs&...) or fn(Cs&...) for every entity that has all of Cs
+		template<typename... Cs, typename Fn>
+		void Each(Fn&& fn) {
+			const uint64_t mask = (uint64_t(0) | ... | Bit<Cs>());
+			for (auto& arch : m_archetypes) {
+				if ((arch->mask & mask) != mask || arch->count == 0) continue;
+				for (size_t c = 0; c < UsedChunks(*arch); ++c)
+					EachInChunk<Cs...>(*arch, c, fn);
+			}
+		}
+
+		// Same as Each, with chunks spread over the ThreadPool. fn must be safe to call concurrently.
+		template<typename... Cs, typename Fn>
+		void ParallelEach(Fn&& fn, rlx::ThreadPool& pool = rlx::ThreadPool::Instance()) {
+			const uint64_t mask = (uint64_t(0) | ... | Bit<Cs>());
+			m_jobs.clear();
+			for (auto& arch : m_archetypes) {
+				if ((arch->mask & mask) != mask || arch->count == 0) continue;
+				for (uint32_t c = 0; c < UsedChunks(*arch); ++c)
+					m_jobs.push_back({ arch->id, c });
+			}
+			pool.ParallelFor(m_jobs.size(), 1, [&](size_t begin, size_t end) {
+				for (size_t j = begin; j < end; ++j)
+					EachInChunk<Cs...>(*m_archetypes[m_jobs[j].first], m_jobs[j].second, fn);
+			});
+		}
+
+		template<typename... Cs>
+		size_t Count() {
+			const uint64_t mask = (uint64_t(0) | ... | Bit<Cs>());
+			size_t total = 0;
+			for (auto& arch : m_archetypes)
+				if ((arch->mask & mask) == mask) total += arch->count;
+			return total;
+		}
+
+		size_t GetArchetypeCount() const { return m_archetypes.size(); }
+
+		// Allocated chunks over all archetypes, including the one spare each may keep
+		size_t GetChunkCount() const {
+			size_t total = 0;
+			for (auto& arch : m_archetypes)
+				total += arch->chunks.size();
+			return total;
+		}
+
+	private:
+		static constexpr uint32_t InvalidArchetype = std::numeric_limits<uint32_t>::max();
+
+		struct ComponentInfo {
+			size_t size = 0;
+			size_t align = 0;
+			void (*moveTo)(void* dst, void* src) = nullptr;	// move-construct dst, destroy src
+			void (*destroy)(void* p) = nullptr;
+		};
+
+		struct Chunk {
+			std::byte* memory = nullptr;
+			Entity* entities = nullptr;
+			std::vector<std::byte*> columns;
+		};
+
+		struct Archetype {
+			uint32_t id = 0;
+			uint64_t mask = 0;
+			std::vector<uint32_t> types;	// component ids, ascending
+			int8_t columnOf[MaxComponents];
+			size_t capacity = 0;	// rows per chunk
+			size_t count = 0;
+			std::vector<Chunk> chunks;
+		};
+
+		struct Record {
+			uint32_t archetype = InvalidArchetype;
+			uint32_t row = 0;
+			uint32_t generation = 0;
+		};
+
+		static uint32_t NextTypeId() {
+			static std::atomic<uint32_t> counter{ 0 };
+			uint32_t id = counter.fetch_add(1, std::memory_order_relaxed);
+			if (id >= MaxComponents)
+				throw std::length_error("Registry supports at most 64 component types.");
+			return id;
+		}
+
+		template<typename C>
+		static uint32_t TypeId() {
+			static const uint32_t id = NextTypeId();
+			return id;
+		}
+
+		template<typename C>
+		uint64_t Bit() {
+			uint32_t id = TypeId<C>();
+			if (!m_info[id].moveTo) {
+				m_info[id] = ComponentInfo{
+					sizeof(C), alignof(C),
+					[](void* dst, void* src) { new (dst) C(std::move(*static_cast<C*>(src))); static_cast<C*>(src)->~C(); },
+					[](void* p) { static_cast<C*>(p)->~C(); }
+				};
+			}
+			return uint64_t(1) << id;
+		}
+
+		template<typename C>
+		uint64_t Bit() const { return uint64_t(1) << TypeId<C>(); }
+
+		template<typename... Ts>
+		static constexpr bool AllUnique() {
+			if constexpr (sizeof...(Ts) <= 1) return true;
+			else return HeadUnique<Ts...>();
+		}
+
+		template<typename T, typename... Rest>
+		static constexpr bool HeadUnique() {
+			return (!std::is_same_v<T, Rest> && ...) && AllUnique<Rest...>();
+		}
+
+		Archetype& GetArchetype(uint64_t mask) {
+			auto it = m_archetypeIndex.find(mask);
+			if (it != m_archetypeIndex.end())
+				return *m_archetypes[it->second];
+
+			auto arch = std::make_unique<Archetype>();
+			arch->id = static_cast<uint32_t>(m_archetypes.size());
+			arch->mask = mask;
+			std::fill(std::begin(arch->columnOf), std::end(arch->columnOf), int8_t(-1));
+			size_t rowBytes = sizeof(Entity);
+			size_t alignSlack = alignof(Entity);
+			for (uint32_t id = 0; id < MaxComponents; ++id) {
+				if (!(mask & (uint64_t(1) << id))) continue;
+				arch->columnOf[id] = static_cast<int8_t>(arch->types.size());
+				arch->types.push_back(id);
+				rowBytes += m_info[id].size;
+				alignSlack += m_info[id].align;
+			}
+			arch->capacity = std::max<size_t>(1, (ChunkBytes - std::min(ChunkBytes, alignSlack)) / rowBytes);
+
+			m_archetypeIndex[mask] = arch->id;
+			m_archetypes.push_back(std::move(arch));
+			return *m_archetypes.back();
+		}
+
+		static size_t AlignUp(size_t offset, size_t align) { return (offset + align - 1) & ~(align - 1); }
+
+		void AddChunk(Archetype& arch) {
+			size_t offset = sizeof(Entity) * arch.capacity;
+			std::vector<size_t> offsets;
+			for (uint32_t id : arch.types) {
+				offset = AlignUp(offset, m_info[id].align);
+				offsets.push_back(offset);
+				offset += m_info[id].size * arch.capacity;
+			}
+
+			Chunk chunk;
+			chunk.memory = static_cast<std::byte*>(::operator new(std::max(offset, size_t(1)), std::align_val_t{ 64 }));
+			chunk.entities = reinterpret_cast<Entity*>(chunk.memory);
+			for (size_t o : offsets)
+				chunk.columns.push_back(chunk.memory + o);
+			arch.chunks.push_back(std::move(chunk));
+		}
+
+		void FreeChunk(Archetype& arch) {
+			::operator delete(arch.chunks.back().memory, std::align_val_t{ 64 });
+			arch.chunks.pop_back();
+		}
+
+		static size_t UsedChunks(const Archetype& arch) { return (arch.count + arch.capacity - 1) / arch.capacity; }
+
+		void* Slot(Archetype& arch, int column, size_t row) {
+			Chunk& chunk = arch.chunks[row / arch.capacity];
+			return chunk.columns[column] + (row % arch.capacity) * m_info[arch.types[column]].size;
+		}
+
+		Entity& EntityAt(Archetype& arch, size_t row) {
+			return arch.chunks[row / arch.capacity].entities[row % arch.capacity];
+		}
+
+		Entity AllocateEntity() {
+			++m_alive;
+			if (!m_free.empty()) {
+				uint32_t index = m_free.back();
+				m_free.pop_back();
+				return Entity{ index, m_records[index].generation };
+			}
+			m_records.push_back(Record{});
+			return Entity{ static_cast<uint32_t>(m_records.size() - 1), 0 };
+		}
+
+		uint32_t AppendRow(Archetype& arch, Entity entity) {
+			if (arch.count == arch.chunks.size() * arch.capacity)
+				AddChunk(arch);
+			uint32_t row = static_cast<uint32_t>(arch.count++);
+			new (&EntityAt(arch, row)) Entity(entity);
+			return row;
+		}
+
+		template<typename C, typename... Args>
+		void Construct(Archetype& arch, uint32_t row, Args&&... args) {
+			new (Slot(arch, arch.columnOf[TypeId<C>()], row)) C(std::forward<Args>(args)...);
+		}
+
+		// Fills the hole at row with the last row. Components still in the hole are destroyed when destroyHole is set.
+		void RemoveRow(Archetype& arch, size_t row, bool destroyHole) {
+			const size_t last = arch.count - 1;
+			for (size_t c = 0; c < arch.types.size(); ++c) {
+				const ComponentInfo& info = m_info[arch.types[c]];
+				void* hole = Slot(arch, static_cast<int>(c), row);
+				if (destroyHole)
+					info.destroy(hole);
+				if (row != last)
+					info.moveTo(hole, Slot(arch, static_cast<int>(c), last));
+			}
+			if (row != last) {
+				Entity moved = EntityAt(arch, last);
+				EntityAt(arch, row) = moved;
+				m_records[moved.index].row = static_cast<uint32_t>(row);
+			}
+			--arch.count;
+			// One empty chunk is kept so churn at a chunk boundary does not allocate and free every time;
+			// it is released once a second one empties
+			if (arch.chunks.size() > UsedChunks(arch) + 1)
+				FreeChunk(arch);
+		}
+
+		// Moves the shared components into a new row of to, destroys the rest, and fills the old hole
+		uint32_t Migrate(Entity entity, Archetype& from, Archetype& to) {
+			Record& record = m_records[entity.index];
+			const uint32_t oldRow = record.row;
+			const uint32_t newRow = AppendRow(to, entity);
+			for (size_t c = 0; c < from.types.size(); ++c) {
+				uint32_t id = from.types[c];
+				void* src = Slot(from, static_cast<int>(c), oldRow);
+				if (to.columnOf[id] >= 0) m_info[id].moveTo(Slot(to, to.columnOf[id], newRow), src);
+				else m_info[id].destroy(src);
+			}
+			RemoveRow(from, oldRow, false);
+			record.archetype = to.id;
+			record.row = newRow;
+			return newRow;
+		}
+
+		template<typename... Cs, typename Fn>
+		void EachInChunk(Archetype& arch, size_t chunkIndex, Fn& fn) {
+			Chunk& chunk = arch.chunks[chunkIndex];
+			const size_t rows = std::min(arch.capacity, arch.count - chunkIndex * arch.capacity);
+			std::tuple<Cs*...> columns{ reinterpret_cast<Cs*>(chunk.columns[arch.columnOf[TypeId<Cs>()]])... };
+			for (size_t i = 0; i < rows; ++i) {
+				if constexpr (std::is_invocable_v<Fn&, Entity, Cs&...>)
+					fn(chunk.entities[i], std::get<Cs*>(columns)[i]...);
+				else
+					fn(std::get<Cs*>(columns)[i]...);
+			}
+		}
+
+		ComponentInfo m_info[MaxComponents]{};
+		std::vector<std::unique_ptr<Archetype>> m_archetypes;
+		std::unordered_map<uint64_t, uint32_t> m_archetypeIndex;
+		std::vector<Record> m_records;
+		std::vector<uint32_t> m_free;
+		size_t m_alive = 0;
+		std::vector<std::pair<uint32_t, uint32_t>> m_jobs;
+	};
+
+	// Layer that owns a Registry and runs its systems in the order they were added
+	class EcsLayer : public Layer {
+	public:
+		using System = std::function<void(Registry&, float)>;
+
+		Registry World;
+
+		void AddSystem(const std::string& name, System system) {
+			if (!m_systems.emplace(name, std::move(system)).second)
+				throw std::invalid_argument("Duplicate system name: " + name);
+		}
+
+		void AddRenderSystem(const std::string& name, System system) {
+			if (!m_renderSystems.emplace(name, std::move(system)).second)
+				throw std::invalid_argument("Duplicate render system name: " + name);
+		}
+
+		void RemoveSystem(const std::string& name) {
+			m_systems.erase(name);
+			m_renderSystems.erase(name);
+		}
+
+		void OnUpdate() override {
+			float dt = rlx::Input::GetFrameTime();
+			for (auto& [_, system] : m_systems)
+				system(World, dt);
+		}
+
+		void OnRender() override {
+			float dt = rlx::Input::GetFrameTime();
+			for (auto& [_, system] : m_renderSystems)
+				system(World, dt);
+		}
+
+	private:
+		ordered_map<std::string, System> m_systems;
+		ordered_map<std::string, System> m_renderSystems;
+	};
+
+	class Window {
+	public:
+		~Window() {
+			if (IsWindowReady())
+				CloseWindow();
+		}
+
+		inline static std::unique_ptr<Window> Create(
+			int width = 800,
+			int height = 600,
+			const std::string& title = "Raylib Window")
+		{
+			return std::make_unique<Window>(width, height, title);
+		}
+
+		void AddFlag(unsigned int flag) { flags |= flag; }
+		void ClearFlags() { flags = 0; }
+
+		void Show() {
+			if (!IsWindowReady())
+			{
+#ifdef _WIN32
+				SetProcessDPIAware();
+#endif
+				ApplyFlags();
+				InitWindow(width, height, title.c_str());
+			}
+		}
+
+		bool IsReady() const { return IsWindowReady(); }
+		bool ShouldClose() const { return WindowShouldClose(); }
+
+		void SetTitle(const std::string& newTitle) { SetWindowTitle(newTitle.c_str()); }
+		void SetSize(int w, int h) { SetWindowSize(w, h); }
+		void SetPosition(int x, int y) { SetWindowPosition(x, y); }
+		void Focus() { SetWindowFocused(); }
+		void Maximize() { MaximizeWindow(); }
+		void Minimize() { MinimizeWindow(); }
+		void Restore() { RestoreWindow(); }
+		void ToggleFullscreen() { ::ToggleFullscreen(); }
+
+		Vector2 GetPosition() const { return GetWindowPosition(); }
+		Vector2 GetSize() const { return { (float)GetScreenWidth(), (float)GetScreenHeight() }; }
+
+#ifdef _WIN32
+		HWND GetHandle() const { return (HWND)GetWindowHandle(); }
+#endif
+
+		Window(int w, int h, const std::string& t)
+			: width(w), height(h), title(t), flags(0) {
+		}
+
+	private:
+		int width;
+		int height;
+		std::string title;
+		unsigned int flags;
+
+		void ApplyFlags() {
+			if (flags != 0)
+				SetConfigFlags(flags);
+		}
+	};
+
+	class Application {
+	public:
+		bool UpscaleEnabled = false;
+		uint8_t UpscaleFactor = 1;
+		rlx::Managed<RenderTexture2D> UpscaleTexture{};
+		Color ClearBackgroundColor = BLACK;
+	public:
+		static void InitializeComponents(
+			int width = 800,
+			int height = 600,
+			const std::string& title = "Raylib Application")
+		{
+			auto& app = Instance();
+			if (!app.window)
+				app.window = Window::Create(width, height, title);
+		}
+
+		static Window* GetWindow() {
+			return Instance().window.get();
+		}
+
+		static void Run(std::function<void()> loop = nullptr) {
+			auto& app = Instance();
+
+			if (!app.window)
+				throw std::runtime_error("Application window does not exist.");
+
+			ShowWindow(app);
+
+			rlx::FramePacer& pacer = app.m_pacer;
+			const bool paced = pacer.GetMode() != rlx::FramePacer::Mode::Off;
+			if (paced)
+				::SetTargetFPS(0);	// the pacer replaces raylib's frame limiter
+			pacer.Resync();
+
+			while (app.window && !app.window->ShouldClose()) {
+				pacer.BeginFrame();
+				PollInput();
+				app.m_frameArena.NextFrame();
+				rlx::Input::BeginFrame(paced || CustomFrameControl ? pacer.GetFrameTime() : ::GetFrameTime());
+				if (rlx::Input::IsReplaying() && rlx::Input::IsReplayFinished())
+					break;
+				if (loop) loop();
+				else {
+					UpdateLayers(app);
+					RenderLayers(app);
+				}
+				pacer.EndFrame();
+				Present();
+			}
+		}
+
+		// Paces Run() with rlx::FramePacer instead of raylib's SetTargetFPS. The pacer has to wait before the
+		// buffer swap and input poll, which needs raylib built with SUPPORT_CUSTOM_FRAME_CONTROL and
+		// RLX_CUSTOM_FRAME_CONTROL defined so that Run() does both itself. Otherwise EndDrawing polls before
+		// Run() regains control and a wait there would hand every frame stale input, so the target goes to
+		// raylib's limiter (which waits before polling) and the pacer stays Off, only measuring frames.
+		// Off in the default build hands pacing back to raylib, whose target FPS has to be set again. With custom
+		// frame control EndDrawing never waits, so Off leaves nothing limiting the frame rate.
+		static void SetFramePacing(rlx::FramePacer::Mode mode, double targetFPS = 60.0) {
+			rlx::FramePacer& pacer = Instance().m_pacer;
+			if constexpr (!CustomFrameControl) {
+				if (mode != rlx::FramePacer::Mode::Off)
+					SetTargetFPS(static_cast<int>(std::lround(targetFPS)));
+				mode = rlx::FramePacer::Mode::Off;
+			}
+			pacer.SetMode(mode);
+			pacer.SetTargetFPS(targetFPS);
+		}
+
+		// raylib's SetTargetFPS, remembered so that Replay() can restore it afterwards (raylib has no getter).
+		// Has no effect with custom frame control; cap the frame rate with SetFramePacing() there.
+		static void SetTargetFPS(int fps) {
+			Instance().m_targetFPS = fps;
+			::SetTargetFPS(fps);
+		}
+
+		static int GetTargetFPS() { return Instance().m_targetFPS; }
+
+		static rlx::FramePacer& GetFramePacer() {
+			return Instance().m_pacer;
+		}
+
+		static const rlx::FramePacerStats& GetFramePacerStats() {
+			return Instance().m_pacer.GetStats();
+		}
+
+		// Runs the layers once per recorded frame with input and frame time taken from the log, without a
+		// frame rate limit, and times each frame's update and render. The target set with SetTargetFPS() is
+		// restored afterwards. Layers must read input and frame time
+		// through rlx::Input for the workload to be identical between runs.
+		static rlx::ReplayReport Replay(rlx::InputLog log, const rlx::ReplayOptions& options = {}) {
+			auto& app = Instance();
+
+			if (options.render) {
+				if (!app.window)
+					throw std::runtime_error("Application window does not exist.");
+				ShowWindow(app);
+				::SetTargetFPS(0);
+			}
+			auto finish = [&]() {
+				rlx::Input::StopReplay();
+				if (options.render)
+					::SetTargetFPS(app.m_targetFPS);
+			};
+
+			using Clock = std::chrono::steady_clock;
+			auto elapsed = [](Clock::time_point from, Clock::time_point to) {
+				return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+			};
+
+			rlx::ReplayReport report;
+			report.name = options.name;
+			report.frames.reserve(log.size());
+			rlx::Input::StartReplay(std::move(log));
+			const Clock::time_point start = Clock::now();
+			try {
+				while (!options.render || (app.window && !app.window->ShouldClose())) {
+					app.m_frameArena.NextFrame();
+					rlx::Input::BeginFrame();
+					if (rlx::Input::IsReplayFinished())
+						break;
+
+					PollInput();	// keeps the window responsive; replayed input ignores it
+					rlx::ReplayFrameTiming timing;
+					timing.dt = rlx::Input::GetFrameTime();
+					const Clock::time_point t0 = Clock::now();
+					UpdateLayers(app);
+					const Clock::time_point t1 = Clock::now();
+					timing.updateNs = elapsed(t0, t1);
+					if (options.render) {
+						RenderLayers(app);
+						Present();
+						timing.renderNs = elapsed(t1, Clock::now());
+					}
+					report.frames.push_back(timing);
+				}
+			}
+			catch (...) {
+				finish();
+				throw;
+			}
+			report.wallNs = elapsed(start, Clock::now());
+			finish();
+
+			if (!options.timingsPath.empty())
+				report.Save(options.timingsPath);
+			return report;
+		}
+
+		template<typename TLayer, typename... Args>
+		static void Add(Args&&... args)
+		{
+			static_assert(std::is_base_of_v<Core::Layer, TLayer>,
+				"TLayer must derive from Core::Layer");
+
+			auto& app = Instance();
+			uint32_t id = static_cast<uint32_t>(app.m_Layers.size());
+
+			auto layer = std::make_unique<TLayer>(std::forward<Args>(args)...);
+			if (layer->Identifier.empty())
+				throw std::invalid_argument("Layer Identifier was not set.");
+
+			for (auto& [key, existing] : app.m_Layers)
+			{
+				if (existing && existing->Identifier == layer->Identifier)
+					throw std::invalid_argument("Duplicate layer identifier: " + layer->Identifier);
+			}
+
+			layer->FrameMemory = &app.m_frameArena;
+			app.m_Layers.emplace(id, std::move(layer));
+		}
+
+		template<typename TLayer>
+			requires(std::is_base_of_v<Core::Layer, TLayer>)
+		static void Remove()
+		{
+			auto& app = Instance();
 
 			for (auto it = app.m_Layers.begin(); it != app.m_Layers.end(); ++it)
 			{
@@ -1000,6 +5873,19 @@ namespace Core
 			return { offsetX, offsetY, renderW, renderH };
 		}
 
+		// Double-buffered scratch arena reset at the start of every frame
+		static rlx::FrameArena& GetFrameArena() {
+			return Instance().m_frameArena;
+		}
+
+		static std::pmr::memory_resource* GetFrameResource() {
+			return &Instance().m_frameArena;
+		}
+
+		static const rlx::FrameArenaStats& GetFrameArenaStats() {
+			return Instance().m_frameArena.GetStats();
+		}
+
 		static Application& Instance() {
 			static Application instance;
 			return instance;
@@ -1008,8 +5894,62 @@ namespace Core
 		// Only allows single window for now
 		std::unique_ptr<Window> window;
 
+		rlx::FrameArena m_frameArena;
+		rlx::FramePacer m_pacer;
+		int m_targetFPS = 0;
+
 		ordered_map<uint32_t, std::unique_ptr<Layer>> m_Layers;
 
+#ifdef RLX_CUSTOM_FRAME_CONTROL
+		static constexpr bool CustomFrameControl = true;
+
+		static void PollInput() { PollInputEvents(); }
+		static void Present() { SwapScreenBuffer(); }
+#else
+		static constexpr bool CustomFrameControl = false;
+
+		// EndDrawing() swaps buffers and polls input
+		static void PollInput() {}
+		static void Present() {}
+#endif
+
+		static void ShowWindow(Application& app) {
+			if (!app.window->IsReady()) {
+				app.window->Show();
+				for (auto& [_, layer] : app.m_Layers)
+					layer->OnShow();
+			}
+		}
+
+		static void UpdateLayers(Application& app) {
+			for (auto& [_, layer] : app.m_Layers)
+				layer->OnUpdate();
+		}
+
+		static void RenderLayers(Application& app) {
+			if (app.UpscaleEnabled && app.UpscaleTexture.IsLoaded()) {
+				rlx::BeginUpscaleRender(app.UpscaleTexture, (float)app.UpscaleFactor);
+				ClearBackground(app.ClearBackgroundColor);
+				for (auto& [_, layer] : app.m_Layers)
+					layer->OnRender();
+				rlx::EndUpscaleRender(app.UpscaleTexture, app.ClearBackgroundColor, [&]() {
+						for (auto& [_, layer] : app.m_Layers)
+							layer->OnRender_Before_Unscaled();
+					},
+					[&]() {
+						for (auto& [_, layer] : app.m_Layers)
+							layer->OnRender_After_Unscaled();
+					});
+			}
+			else {
+				BeginDrawing();
+				ClearBackground(app.ClearBackgroundColor);
+				for (auto& [_, layer] : app.m_Layers)
+					layer->OnRender();
+				EndDrawing();
+			}
+		}
+
 		Application() = default;
 		~Application() = default;
 
@@ -0,0 +1,33 @@
+#include "rlx_test.h"
+#include <cstring>
+#include <exception>
+
+// rlx_tests [suite...]   runs every case, or only the named suites
+int main(int argc, char** argv)
+{
+	int run = 0;
+	for (const rlxtest::Case& c : rlxtest::Cases()) {
+		bool selected = argc < 2;
+		for (int i = 1; i < argc && !selected; ++i)
+			selected = std::strcmp(argv[i], c.suite) == 0;
+		if (!selected) continue;
+
+		++run;
+		const int before = rlxtest::Failures();
+		try {
+			c.fn();
+		}
+		catch (const rlxtest::AbortCase&) {}
+		catch (const std::exception& e) {
+			rlxtest::Fail(__FILE__, __LINE__, std::string("unexpected exception: ") + e.what());
+		}
+		std::printf("[%s] %s.%s\n", rlxtest::Failures() == before ? " OK " : "FAIL", c.suite, c.name);
+	}
+
+	if (run == 0) {
+		std::fprintf(stderr, "no test cases selected\n");
+		return 1;
+	}
+	std::printf("%d case(s), %d failure(s)\n", run, rlxtest::Failures());
+	return rlxtest::Failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#pragma once
+// Minimal test harness: TEST(Suite, Name) registers a case; CHECK* record failures and continue,
+// REQUIRE aborts the current case.
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace rlxtest {
+	struct Case {
+		const char* suite;
+		const char* name;
+		void (*fn)();
+	};
+
+	struct AbortCase {};
+
+	inline std::vector<Case>& Cases() {
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	inline int& Failures() {
+		static int failures = 0;
+		return failures;
+	}
+
+	struct Registrar {
+		Registrar(const char* suite, const char* name, void (*fn)()) { Cases().push_back({ suite, name, fn }); }
+	};
+
+	inline void Fail(const char* file, int line, const std::string& message) {
+		++Failures();
+		std::fprintf(stderr, "  %s:%d: %s\n", file, line, message.c_str());
+	}
+
+	template<typename T>
+	std::string Show(const T& value) {
+		if constexpr (std::is_convertible_v<T, std::string>) {
+			std::string quoted(1, '"');
+			quoted.append(std::string(value)).push_back('"');
+			return quoted;
+		}
+		else if constexpr (std::is_arithmetic_v<T>) return std::to_string(value);
+		else if constexpr (std::is_enum_v<T>) return std::to_string(static_cast<long long>(value));
+		else return "<value>";
+	}
+}
+
+#define RLX_TEST_CONCAT2(a, b) a##b
+#define RLX_TEST_CONCAT(a, b) RLX_TEST_CONCAT2(a, b)
+
+#define TEST(suite, name) \
+	static void RLX_TEST_CONCAT(suite##_, name)(); \
+	static rlxtest::Registrar RLX_TEST_CONCAT(suite##_##name, _registrar)(#suite, #name, &RLX_TEST_CONCAT(suite##_, name)); \
+	static void RLX_TEST_CONCAT(suite##_, name)()
+
+#define CHECK(expr) \
+	do { if (!(expr)) rlxtest::Fail(__FILE__, __LINE__, "CHECK(" #expr ")"); } while (0)
+
+#define REQUIRE(expr) \
+	do { if (!(expr)) { rlxtest::Fail(__FILE__, __LINE__, "REQUIRE(" #expr ")"); throw rlxtest::AbortCase{}; } } while (0)
+
+#define CHECK_EQ(a, b) \
+	do { \
+		auto&& _a = (a); auto&& _b = (b); \
+		if (!(_a == _b)) rlxtest::Fail(__FILE__, __LINE__, "CHECK_EQ(" #a ", " #b "): " + rlxtest::Show(_a) + " != " + rlxtest::Show(_b)); \
+	} while (0)
+
+#define CHECK_NEAR(a, b, eps) \
+	do { \
+		double _a = (double)(a), _b = (double)(b); \
+		if (!(std::fabs(_a - _b) <= (eps))) rlxtest::Fail(__FILE__, __LINE__, "CHECK_NEAR(" #a ", " #b "): " + std::to_string(_a) + " vs " + std::to_string(_b)); \
+	} while (0)
+
+#define CHECK_THROWS(expr, type) \
+	do { \
+		bool _thrown = false; \
+		try { (void)(expr); } catch (const type&) { _thrown = true; } catch (...) {} \
+		if (!_thrown) rlxtest::Fail(__FILE__, __LINE__, "CHECK_THROWS(" #expr ", " #type ")"); \
+	} while (0)
@@ -0,0 +1,49 @@
+// Controls for the headless raylib stub (test and benchmark builds only)
+#ifndef RLX_HEADLESS_H
+#define RLX_HEADLESS_H
+
+#include "raylib.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// WindowShouldClose() returns true once this many more frames have ended (<0: never)
+void HeadlessSetFrameLimit(int frames);
+// Frames ended since InitWindow()
+long long HeadlessGetFrameCount(void);
+// Last value passed to SetTargetFPS()
+int HeadlessGetTargetFPS(void);
+// Value returned by GetFrameTime(); <=0 reports measured wall time between frames
+void HeadlessSetFrameTime(float seconds);
+// Draw calls submitted since the last reset
+long long HeadlessGetDrawCalls(void);
+void HeadlessResetCounters(void);
+// Frame loop calls since the last reset, in order: 's' buffer swap, 'w' WaitTime() or the SetTargetFPS()
+// limiter in EndDrawing(), 'p' input poll, plus anything added with HeadlessMark()
+const char *HeadlessGetEvents(void);
+void HeadlessMark(char event);
+// Copy of the pixels passed to the last UpdateTexture() / UpdateTextureRec()
+const unsigned char *HeadlessGetLastUpload(int *size);
+
+// LoadFontData() returns NULL for any batch containing this codepoint (-1: none)
+void HeadlessFailFontCodepoint(int codepoint);
+
+// Audio stream buffers: the SetAudioStreamBufferSizeDefault() value, a stream's size in frames as
+// loaded (with the frame count of its last UpdateAudioStream()), and how many updates it received
+int HeadlessGetAudioBufferSizeDefault(void);
+int HeadlessGetAudioStreamFrames(AudioStream stream, int *lastFrameCount);
+int HeadlessGetAudioStreamUpdates(AudioStream stream);
+
+// Simulated input, visible to raylib input queries from the next PollInputEvents() / EndDrawing()
+void HeadlessSetKeyDown(int key, bool down);
+void HeadlessSetMouseButtonDown(int button, bool down);
+void HeadlessSetMousePosition(float x, float y);
+void HeadlessSetMouseWheel(float x, float y);
+void HeadlessPushChar(int codepoint);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,324 @@
+// Headless raylib API subset (declarations match raylib 5.x)
+#ifndef RAYLIB_H
+#define RAYLIB_H
+#include <stdarg.h>
+#include <stdbool.h>
+
+#define RAYLIB_VERSION_MAJOR 5
+#define RAYLIB_VERSION_MINOR 5
+#define RAYLIB_VERSION "5.5"
+
+#ifndef PI
+	#define PI 3.14159265358979323846f
+#endif
+#define DEG2RAD (PI/180.0f)
+#define RAD2DEG (180.0f/PI)
+
+#define CLITERAL(type) type
+
+#define LIGHTGRAY  CLITERAL(Color){ 200, 200, 200, 255 }
+#define GRAY       CLITERAL(Color){ 130, 130, 130, 255 }
+#define DARKGRAY   CLITERAL(Color){ 80, 80, 80, 255 }
+#define YELLOW     CLITERAL(Color){ 253, 249, 0, 255 }
+#define RED        CLITERAL(Color){ 230, 41, 55, 255 }
+#define GREEN      CLITERAL(Color){ 0, 228, 48, 255 }
+#define BLUE       CLITERAL(Color){ 0, 121, 241, 255 }
+#define WHITE      CLITERAL(Color){ 255, 255, 255, 255 }
+#define BLACK      CLITERAL(Color){ 0, 0, 0, 255 }
+#define BLANK      CLITERAL(Color){ 0, 0, 0, 0 }
+#define MAGENTA    CLITERAL(Color){ 255, 0, 255, 255 }
+#define RAYWHITE   CLITERAL(Color){ 245, 245, 245, 255 }
+
+typedef struct Vector2 { float x; float y; } Vector2;
+typedef struct Vector3 { float x; float y; float z; } Vector3;
+typedef struct Vector4 { float x; float y; float z; float w; } Vector4;
+typedef Vector4 Quaternion;
+typedef struct Matrix {
+	float m0, m4, m8, m12;
+	float m1, m5, m9, m13;
+	float m2, m6, m10, m14;
+	float m3, m7, m11, m15;
+} Matrix;
+typedef struct Color { unsigned char r; unsigned char g; unsigned char b; unsigned char a; } Color;
+typedef struct Rectangle { float x; float y; float width; float height; } Rectangle;
+typedef struct Image { void *data; int width; int height; int mipmaps; int format; } Image;
+typedef struct Texture { unsigned int id; int width; int height; int mipmaps; int format; } Texture;
+typedef Texture Texture2D;
+typedef Texture TextureCubemap;
+typedef struct RenderTexture { unsigned int id; Texture texture; Texture depth; } RenderTexture;
+typedef RenderTexture RenderTexture2D;
+typedef struct NPatchInfo { Rectangle source; int left; int top; int right; int bottom; int layout; } NPatchInfo;
+typedef struct GlyphInfo { int value; int offsetX; int offsetY; int advanceX; Image image; } GlyphInfo;
+typedef struct Font { int baseSize; int glyphCount; int glyphPadding; Texture2D texture; Rectangle *recs; GlyphInfo *glyphs; } Font;
+typedef struct Camera3D { Vector3 position; Vector3 target; Vector3 up; float fovy; int projection; } Camera3D;
+typedef Camera3D Camera;
+typedef struct Camera2D { Vector2 offset; Vector2 target; float rotation; float zoom; } Camera2D;
+typedef struct Mesh {
+	int vertexCount; int triangleCount;
+	float *vertices; float *texcoords; float *texcoords2; float *normals; float *tangents;
+	unsigned char *colors; unsigned short *indices;
+	float *animVertices; float *animNormals; unsigned char *boneIds; float *boneWeights;
+	Matrix *boneMatrices; int boneCount;
+	unsigned int vaoId; unsigned int *vboId;
+} Mesh;
+typedef struct Shader { unsigned int id; int *locs; } Shader;
+typedef struct MaterialMap { Texture2D texture; Color color; float value; } MaterialMap;
+typedef struct Material { Shader shader; MaterialMap *maps; float params[4]; } Material;
+typedef struct Transform { Vector3 translation; Quaternion rotation; Vector3 scale; } Transform;
+typedef struct BoneInfo { char name[32]; int parent; } BoneInfo;
+typedef struct Model {
+	Matrix transform; int meshCount; int materialCount; Mesh *meshes; Material *materials; int *meshMaterial;
+	int boneCount; BoneInfo *bones; Transform *bindPose;
+} Model;
+typedef struct BoundingBox { Vector3 min; Vector3 max; } BoundingBox;
+typedef struct Wave { unsigned int frameCount; unsigned int sampleRate; unsigned int sampleSize; unsigned int channels; void *data; } Wave;
+typedef struct rAudioBuffer rAudioBuffer;
+typedef struct rAudioProcessor rAudioProcessor;
+typedef struct AudioStream { rAudioBuffer *buffer; rAudioProcessor *processor; unsigned int sampleRate; unsigned int sampleSize; unsigned int channels; } AudioStream;
+typedef struct Sound { AudioStream stream; unsigned int frameCount; } Sound;
+typedef struct Music { AudioStream stream; unsigned int frameCount; bool looping; int ctxType; void *ctxData; } Music;
+
+typedef enum {
+	FLAG_VSYNC_HINT = 0x00000040, FLAG_FULLSCREEN_MODE = 0x00000002, FLAG_WINDOW_RESIZABLE = 0x00000004,
+	FLAG_WINDOW_UNDECORATED = 0x00000008, FLAG_WINDOW_HIDDEN = 0x00000080, FLAG_WINDOW_MINIMIZED = 0x00000200,
+	FLAG_WINDOW_MAXIMIZED = 0x00000400, FLAG_WINDOW_UNFOCUSED = 0x00000800, FLAG_WINDOW_TOPMOST = 0x00001000,
+	FLAG_WINDOW_ALWAYS_RUN = 0x00000100, FLAG_WINDOW_TRANSPARENT = 0x00000010, FLAG_WINDOW_HIGHDPI = 0x00002000,
+	FLAG_WINDOW_MOUSE_PASSTHROUGH = 0x00004000, FLAG_BORDERLESS_WINDOWED_MODE = 0x00008000,
+	FLAG_MSAA_4X_HINT = 0x00000020, FLAG_INTERLACED_HINT = 0x00010000
+} ConfigFlags;
+
+typedef enum {
+	KEY_NULL = 0, KEY_APOSTROPHE = 39, KEY_COMMA = 44, KEY_MINUS = 45, KEY_PERIOD = 46, KEY_SLASH = 47,
+	KEY_ZERO = 48, KEY_ONE = 49, KEY_TWO = 50, KEY_THREE = 51, KEY_FOUR = 52, KEY_FIVE = 53, KEY_SIX = 54,
+	KEY_SEVEN = 55, KEY_EIGHT = 56, KEY_NINE = 57, KEY_SEMICOLON = 59, KEY_EQUAL = 61,
+	KEY_A = 65, KEY_B = 66, KEY_C = 67, KEY_D = 68, KEY_E = 69, KEY_F = 70, KEY_G = 71, KEY_H = 72, KEY_I = 73,
+	KEY_J = 74, KEY_K = 75, KEY_L = 76, KEY_M = 77, KEY_N = 78, KEY_O = 79, KEY_P = 80, KEY_Q = 81, KEY_R = 82,
+	KEY_S = 83, KEY_T = 84, KEY_U = 85, KEY_V = 86, KEY_W = 87, KEY_X = 88, KEY_Y = 89, KEY_Z = 90,
+	KEY_SPACE = 32, KEY_ESCAPE = 256, KEY_ENTER = 257, KEY_TAB = 258, KEY_BACKSPACE = 259,
+	KEY_RIGHT = 262, KEY_LEFT = 263, KEY_DOWN = 264, KEY_UP = 265,
+	KEY_LEFT_SHIFT = 340, KEY_LEFT_CONTROL = 341, KEY_LEFT_ALT = 342, KEY_LEFT_SUPER = 343,
+	KEY_RIGHT_SHIFT = 344, KEY_RIGHT_CONTROL = 345, KEY_RIGHT_ALT = 346, KEY_RIGHT_SUPER = 347, KEY_KB_MENU = 348
+} KeyboardKey;
+
+typedef enum {
+	MOUSE_BUTTON_LEFT = 0, MOUSE_BUTTON_RIGHT = 1, MOUSE_BUTTON_MIDDLE = 2, MOUSE_BUTTON_SIDE = 3,
+	MOUSE_BUTTON_EXTRA = 4, MOUSE_BUTTON_FORWARD = 5, MOUSE_BUTTON_BACK = 6
+} MouseButton;
+
+typedef enum {
+	PIXELFORMAT_UNCOMPRESSED_GRAYSCALE = 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, PIXELFORMAT_UNCOMPRESSED_R5G6B5,
+	PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4,
+	PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32,
+	PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, PIXELFORMAT_UNCOMPRESSED_R16, PIXELFORMAT_UNCOMPRESSED_R16G16B16,
+	PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, PIXELFORMAT_COMPRESSED_DXT1_RGB, PIXELFORMAT_COMPRESSED_DXT1_RGBA,
+	PIXELFORMAT_COMPRESSED_DXT3_RGBA, PIXELFORMAT_COMPRESSED_DXT5_RGBA, PIXELFORMAT_COMPRESSED_ETC1_RGB,
+	PIXELFORMAT_COMPRESSED_ETC2_RGB, PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, PIXELFORMAT_COMPRESSED_PVRT_RGB,
+	PIXELFORMAT_COMPRESSED_PVRT_RGBA, PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA, PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA
+} PixelFormat;
+
+typedef enum { TEXTURE_FILTER_POINT = 0, TEXTURE_FILTER_BILINEAR, TEXTURE_FILTER_TRILINEAR } TextureFilter;
+typedef enum { FONT_DEFAULT = 0, FONT_BITMAP, FONT_SDF } FontType;
+typedef enum { BLEND_ALPHA = 0, BLEND_ADDITIVE, BLEND_MULTIPLIED, BLEND_ADD_COLORS, BLEND_SUBTRACT_COLORS, BLEND_ALPHA_PREMULTIPLY, BLEND_CUSTOM, BLEND_CUSTOM_SEPARATE } BlendMode;
+typedef enum { CAMERA_PERSPECTIVE = 0, CAMERA_ORTHOGRAPHIC } CameraProjection;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Window
+void InitWindow(int width, int height, const char *title);
+void CloseWindow(void);
+bool WindowShouldClose(void);
+bool IsWindowReady(void);
+void SetConfigFlags(unsigned int flags);
+void SetWindowTitle(const char *title);
+void SetWindowPosition(int x, int y);
+void SetWindowSize(int width, int height);
+void SetWindowFocused(void);
+void MaximizeWindow(void);
+void MinimizeWindow(void);
+void RestoreWindow(void);
+void ToggleFullscreen(void);
+void *GetWindowHandle(void);
+int GetScreenWidth(void);
+int GetScreenHeight(void);
+Vector2 GetWindowPosition(void);
+
+// Drawing
+void ClearBackground(Color color);
+void BeginDrawing(void);
+void EndDrawing(void);
+void BeginMode2D(Camera2D camera);
+void EndMode2D(void);
+void BeginMode3D(Camera3D camera);
+void EndMode3D(void);
+void BeginTextureMode(RenderTexture2D target);
+void EndTextureMode(void);
+void BeginBlendMode(int mode);
+void EndBlendMode(void);
+Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera);
+Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera);
+Matrix GetCameraMatrix(Camera camera);
+Matrix GetCameraMatrix2D(Camera2D camera);
+
+// Timing
+void SetTargetFPS(int fps);
+float GetFrameTime(void);
+double GetTime(void);
+int GetFPS(void);
+void SwapScreenBuffer(void);
+void PollInputEvents(void);
+void WaitTime(double seconds);
+
+// Misc
+void SetTraceLogLevel(int logLevel);
+void TraceLog(int logLevel, const char *text, ...);
+void *MemAlloc(unsigned int size);
+void *MemRealloc(void *ptr, unsigned int size);
+void MemFree(void *ptr);
+unsigned char *LoadFileData(const char *fileName, int *dataSize);
+void UnloadFileData(unsigned char *data);
+bool SaveFileData(const char *fileName, void *data, int dataSize);
+
+// Input
+bool IsKeyPressed(int key);
+bool IsKeyPressedRepeat(int key);
+bool IsKeyDown(int key);
+bool IsKeyReleased(int key);
+bool IsKeyUp(int key);
+int GetKeyPressed(void);
+int GetCharPressed(void);
+void SetExitKey(int key);
+bool IsMouseButtonPressed(int button);
+bool IsMouseButtonDown(int button);
+bool IsMouseButtonReleased(int button);
+bool IsMouseButtonUp(int button);
+int GetMouseX(void);
+int GetMouseY(void);
+Vector2 GetMousePosition(void);
+Vector2 GetMouseDelta(void);
+float GetMouseWheelMove(void);
+Vector2 GetMouseWheelMoveV(void);
+
+// Shapes
+void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color);
+void DrawRectangle(int posX, int posY, int width, int height, Color color);
+void DrawRectangleRec(Rectangle rec, Color color);
+void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);
+
+// Images
+Image LoadImage(const char *fileName);
+Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);
+void UnloadImage(Image image);
+bool ExportImage(Image image, const char *fileName);
+Image GenImageColor(int width, int height, Color color);
+Image ImageCopy(Image image);
+Image ImageFromImage(Image image, Rectangle rec);
+void ImageFormat(Image *image, int newFormat);
+void ImageResize(Image *image, int newWidth, int newHeight);
+void ImageMipmaps(Image *image);
+void ImageColorTint(Image *image, Color color);
+void ImageColorInvert(Image *image);
+void ImageColorBrightness(Image *image, int brightness);
+void ImageBlurGaussian(Image *image, int blurSize);
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);
+Color GetImageColor(Image image, int x, int y);
+int GetPixelDataSize(int width, int height, int format);
+
+// Textures
+Texture2D LoadTexture(const char *fileName);
+Texture2D LoadTextureFromImage(Image image);
+RenderTexture2D LoadRenderTexture(int width, int height);
+bool IsTextureValid(Texture2D texture);
+void UnloadTexture(Texture2D texture);
+bool IsRenderTextureValid(RenderTexture2D target);
+void UnloadRenderTexture(RenderTexture2D target);
+void UpdateTexture(Texture2D texture, const void *pixels);
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);
+void GenTextureMipmaps(Texture2D *texture);
+void SetTextureFilter(Texture2D texture, int filter);
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint);
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint);
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+Color Fade(Color color, float alpha);
+Color ColorAlpha(Color color, float alpha);
+
+// Fonts / text
+Font GetFontDefault(void);
+Font LoadFont(const char *fileName);
+Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);
+Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount);
+GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type);
+void UnloadFontData(GlyphInfo *glyphs, int glyphCount);
+void UnloadFont(Font font);
+void DrawText(const char *text, int posX, int posY, int fontSize, Color color);
+void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);
+int MeasureText(const char *text, int fontSize);
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);
+int GetGlyphIndex(Font font, int codepoint);
+int GetCodepointNext(const char *text, int *codepointSize);
+
+// Models
+void UploadMesh(Mesh *mesh, bool dynamic);
+void UnloadMesh(Mesh mesh);
+void DrawMesh(Mesh mesh, Material material, Matrix transform);
+void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances);
+BoundingBox GetMeshBoundingBox(Mesh mesh);
+Mesh GenMeshPoly(int sides, float radius);
+Mesh GenMeshPlane(float width, float length, int resX, int resZ);
+Mesh GenMeshCube(float width, float height, float length);
+Mesh GenMeshSphere(float radius, int rings, int slices);
+Mesh GenMeshCylinder(float radius, float height, int slices);
+Mesh GenMeshCone(float radius, float height, int slices);
+Model LoadModel(const char *fileName);
+Model LoadModelFromMesh(Mesh mesh);
+void UnloadModel(Model model);
+Material LoadMaterialDefault(void);
+void UnloadMaterial(Material material);
+
+// Shaders
+Shader LoadShader(const char *vsFileName, const char *fsFileName);
+void UnloadShader(Shader shader);
+
+// Audio
+void InitAudioDevice(void);
+void CloseAudioDevice(void);
+bool IsAudioDeviceReady(void);
+Wave LoadWave(const char *fileName);
+Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);
+void UnloadWave(Wave wave);
+Sound LoadSound(const char *fileName);
+Sound LoadSoundFromWave(Wave wave);
+Sound LoadSoundAlias(Sound source);
+void UnloadSound(Sound sound);
+void UnloadSoundAlias(Sound alias);
+void PlaySound(Sound sound);
+void StopSound(Sound sound);
+void PauseSound(Sound sound);
+void ResumeSound(Sound sound);
+bool IsSoundPlaying(Sound sound);
+void SetSoundVolume(Sound sound, float volume);
+void SetSoundPitch(Sound sound, float pitch);
+void SetSoundPan(Sound sound, float pan);
+Music LoadMusicStream(const char *fileName);
+Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize);
+void UnloadMusicStream(Music music);
+void PlayMusicStream(Music music);
+bool IsMusicStreamPlaying(Music music);
+void UpdateMusicStream(Music music);
+void StopMusicStream(Music music);
+AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels);
+void UnloadAudioStream(AudioStream stream);
+void UpdateAudioStream(AudioStream stream, const void *data, int frameCount);
+bool IsAudioStreamProcessed(AudioStream stream);
+void PlayAudioStream(AudioStream stream);
+void StopAudioStream(AudioStream stream);
+bool IsAudioStreamPlaying(AudioStream stream);
+void SetAudioStreamBufferSizeDefault(int size);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,644 @@
+// Headless raylib: window, timing and resource calls behave plausibly without a GPU or audio device.
+// Drawing only counts submissions. Images and memory are real so CPU-side code paths can be verified.
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "raylib.h"
+#include "rlgl.h"
+#include "headless.h"
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	struct State {
+		bool windowReady = false;
+		bool closeRequested = false;
+		int width = 800;
+		int height = 600;
+		unsigned int flags = 0;
+		int targetFps = 0;
+
+		long long frameLimit = -1;
+		long long frameCount = 0;
+		float fixedFrameTime = 1.0f / 60.0f;
+		Clock::time_point start = Clock::now();
+		Clock::time_point frameStart = Clock::now();
+		float lastFrameTime = 0.0f;
+
+		// Input: pending values are published to the current frame by PollInputEvents()
+		static constexpr int MaxKeys = 512;
+		static constexpr int MaxButtons = 8;
+		static constexpr int MaxChars = 16;
+		bool pendingKeys[MaxKeys] = {};
+		bool keys[MaxKeys] = {};
+		bool prevKeys[MaxKeys] = {};
+		bool pendingButtons[MaxButtons] = {};
+		bool buttons[MaxButtons] = {};
+		bool prevButtons[MaxButtons] = {};
+		Vector2 pendingMouse{ 0.0f, 0.0f };
+		Vector2 mouse{ 0.0f, 0.0f };
+		Vector2 prevMouse{ 0.0f, 0.0f };
+		Vector2 pendingWheel{ 0.0f, 0.0f };
+		Vector2 wheel{ 0.0f, 0.0f };
+		int pendingChars[MaxChars] = {};
+		int pendingCharCount = 0;
+		int chars[MaxChars] = {};
+		int charCount = 0;
+		int charRead = 0;
+
+		long long drawCalls = 0;
+		int failingCodepoint = -1;
+		std::string events;	// frame loop call order, see HeadlessGetEvents()
+		unsigned int nextId = 1;
+		std::vector<unsigned char> lastUpload;	// bytes passed to the last UpdateTexture / UpdateTextureRec
+		std::unordered_map<const void*, bool> playing;
+
+		// Audio streams are fed from AudioFeeder's thread, so their state has its own lock
+		struct StreamBuffer { int frames = 0; int updates = 0; int lastFrameCount = 0; };
+		std::mutex audioMutex;
+		int bufferSizeDefault = 0;
+		std::unordered_map<const void*, StreamBuffer> streams;
+	};
+
+	State& S() {
+		static State state;
+		return state;
+	}
+
+	void CountDraw() { ++S().drawCalls; }
+
+	void Mark(char event) {
+		std::string& events = S().events;
+		if (events.size() < 4096)
+			events.push_back(event);
+	}
+
+	bool ValidKey(int key) { return key >= 0 && key < State::MaxKeys; }
+	bool ValidButton(int button) { return button >= 0 && button < State::MaxButtons; }
+
+	void EndFrame() {
+		State& s = S();
+		Clock::time_point now = Clock::now();
+		s.lastFrameTime = std::chrono::duration<float>(now - s.frameStart).count();
+		s.frameStart = now;
+		++s.frameCount;
+		if (s.frameLimit > 0) --s.frameLimit;
+	}
+
+	void Poll() {
+		State& s = S();
+		Mark('p');
+		memcpy(s.prevKeys, s.keys, sizeof(s.keys));
+		memcpy(s.keys, s.pendingKeys, sizeof(s.keys));
+		memcpy(s.prevButtons, s.buttons, sizeof(s.buttons));
+		memcpy(s.buttons, s.pendingButtons, sizeof(s.buttons));
+		s.prevMouse = s.mouse;
+		s.mouse = s.pendingMouse;
+		s.wheel = s.pendingWheel;
+		s.pendingWheel = { 0.0f, 0.0f };
+		memcpy(s.chars, s.pendingChars, sizeof(s.chars));
+		s.charCount = s.pendingCharCount;
+		s.charRead = 0;
+		s.pendingCharCount = 0;
+	}
+}
+
+extern "C" {
+
+// --- Headless controls ---
+void HeadlessSetFrameLimit(int frames) { S().frameLimit = frames; S().closeRequested = false; }
+long long HeadlessGetFrameCount(void) { return S().frameCount; }
+void HeadlessFailFontCodepoint(int codepoint) { S().failingCodepoint = codepoint; }
+int HeadlessGetAudioBufferSizeDefault(void) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	return s.bufferSizeDefault;
+}
+int HeadlessGetAudioStreamFrames(AudioStream stream, int *lastFrameCount) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	auto it = s.streams.find(stream.buffer);
+	if (it == s.streams.end()) return 0;
+	if (lastFrameCount) *lastFrameCount = it->second.lastFrameCount;
+	return it->second.frames;
+}
+int HeadlessGetAudioStreamUpdates(AudioStream stream) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	auto it = s.streams.find(stream.buffer);
+	return it == s.streams.end() ? 0 : it->second.updates;
+}
+int HeadlessGetTargetFPS(void) { return S().targetFps; }
+void HeadlessSetFrameTime(float seconds) { S().fixedFrameTime = seconds; }
+long long HeadlessGetDrawCalls(void) { return S().drawCalls; }
+void HeadlessResetCounters(void) { S().drawCalls = 0; S().events.clear(); }
+const char *HeadlessGetEvents(void) { return S().events.c_str(); }
+void HeadlessMark(char event) { Mark(event); }
+void HeadlessSetKeyDown(int key, bool down) { if (ValidKey(key)) S().pendingKeys[key] = down; }
+void HeadlessSetMouseButtonDown(int button, bool down) { if (ValidButton(button)) S().pendingButtons[button] = down; }
+void HeadlessSetMousePosition(float x, float y) { S().pendingMouse = { x, y }; }
+void HeadlessSetMouseWheel(float x, float y) { S().pendingWheel = { x, y }; }
+const unsigned char *HeadlessGetLastUpload(int *size) {
+	if (size) *size = (int)S().lastUpload.size();
+	return S().lastUpload.data();
+}
+void HeadlessPushChar(int codepoint) {
+	State& s = S();
+	if (s.pendingCharCount < State::MaxChars) s.pendingChars[s.pendingCharCount++] = codepoint;
+}
+
+// --- Window ---
+void InitWindow(int width, int height, const char*) {
+	State& s = S();
+	s.windowReady = true;
+	s.closeRequested = false;
+	s.width = width;
+	s.height = height;
+	s.frameCount = 0;
+	s.start = s.frameStart = Clock::now();
+}
+void CloseWindow(void) { S().windowReady = false; }
+bool WindowShouldClose(void) { return S().closeRequested || S().frameLimit == 0; }
+bool IsWindowReady(void) { return S().windowReady; }
+void SetConfigFlags(unsigned int flags) { S().flags = flags; }
+void SetWindowTitle(const char*) {}
+void SetWindowPosition(int, int) {}
+void SetWindowSize(int width, int height) { S().width = width; S().height = height; }
+void SetWindowFocused(void) {}
+void MaximizeWindow(void) {}
+void MinimizeWindow(void) {}
+void RestoreWindow(void) {}
+void ToggleFullscreen(void) {}
+void *GetWindowHandle(void) { return nullptr; }
+int GetScreenWidth(void) { return S().width; }
+int GetScreenHeight(void) { return S().height; }
+Vector2 GetWindowPosition(void) { return { 0.0f, 0.0f }; }
+
+// --- Drawing ---
+void ClearBackground(Color) { CountDraw(); }
+void BeginDrawing(void) {}
+#ifdef SUPPORT_CUSTOM_FRAME_CONTROL
+// Built like raylib with SUPPORT_CUSTOM_FRAME_CONTROL: swapping, waiting and polling are left to the caller
+void EndDrawing(void) { EndFrame(); }
+#else
+// Same order as raylib without SUPPORT_CUSTOM_FRAME_CONTROL: swap, wait out the target frame time, poll input
+void EndDrawing(void) {
+	SwapScreenBuffer();
+	State& s = S();
+	if (s.targetFps > 0)
+		WaitTime(1.0 / s.targetFps - std::chrono::duration<double>(Clock::now() - s.frameStart).count());
+	EndFrame();
+	Poll();
+}
+#endif
+void BeginMode2D(Camera2D) {}
+void EndMode2D(void) {}
+void BeginMode3D(Camera3D) {}
+void EndMode3D(void) {}
+void BeginTextureMode(RenderTexture2D) {}
+void EndTextureMode(void) {}
+void BeginBlendMode(int) {}
+void EndBlendMode(void) {}
+
+Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera) {
+	float c = cosf(-camera.rotation * DEG2RAD), s = sinf(-camera.rotation * DEG2RAD);
+	float x = (position.x - camera.offset.x) / camera.zoom;
+	float y = (position.y - camera.offset.y) / camera.zoom;
+	return { x * c - y * s + camera.target.x, x * s + y * c + camera.target.y };
+}
+Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera) {
+	float c = cosf(camera.rotation * DEG2RAD), s = sinf(camera.rotation * DEG2RAD);
+	float x = position.x - camera.target.x;
+	float y = position.y - camera.target.y;
+	return { (x * c - y * s) * camera.zoom + camera.offset.x, (x * s + y * c) * camera.zoom + camera.offset.y };
+}
+Matrix GetCameraMatrix(Camera) { return Matrix{ 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 }; }
+Matrix GetCameraMatrix2D(Camera2D) { return Matrix{ 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 }; }
+
+// --- Timing ---
+void SetTargetFPS(int fps) { S().targetFps = fps; }
+float GetFrameTime(void) { return S().fixedFrameTime > 0.0f ? S().fixedFrameTime : S().lastFrameTime; }
+double GetTime(void) { return std::chrono::duration<double>(Clock::now() - S().start).count(); }
+int GetFPS(void) { float dt = GetFrameTime(); return dt > 0.0f ? (int)roundf(1.0f / dt) : 0; }
+void SwapScreenBuffer(void) { Mark('s'); }
+void PollInputEvents(void) { Poll(); }
+void WaitTime(double seconds) {
+	if (seconds <= 0) return;
+	Mark('w');
+	std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
+
+// --- Misc ---
+void SetTraceLogLevel(int) {}
+void TraceLog(int, const char*, ...) {}
+void *MemAlloc(unsigned int size) { return calloc(size, 1); }
+void *MemRealloc(void *ptr, unsigned int size) { return realloc(ptr, size); }
+void MemFree(void *ptr) { free(ptr); }
+
+unsigned char *LoadFileData(const char *fileName, int *dataSize) {
+	*dataSize = 0;
+	FILE *f = fopen(fileName, "rb");
+	if (!f) return nullptr;
+	fseek(f, 0, SEEK_END);
+	long n = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	unsigned char *data = (unsigned char *)MemAlloc((unsigned int)(n > 0 ? n : 1));
+	*dataSize = (int)fread(data, 1, (size_t)(n > 0 ? n : 0), f);
+	fclose(f);
+	return data;
+}
+void UnloadFileData(unsigned char *data) { MemFree(data); }
+bool SaveFileData(const char *fileName, void *data, int dataSize) {
+	FILE *f = fopen(fileName, "wb");
+	if (!f) return false;
+	bool ok = fwrite(data, 1, (size_t)dataSize, f) == (size_t)dataSize;
+	fclose(f);
+	return ok;
+}
+
+// --- Input (driven by the Headless* setters) ---
+bool IsKeyPressed(int key) { return ValidKey(key) && S().keys[key] && !S().prevKeys[key]; }
+bool IsKeyPressedRepeat(int) { return false; }
+bool IsKeyDown(int key) { return ValidKey(key) && S().keys[key]; }
+bool IsKeyReleased(int key) { return ValidKey(key) && !S().keys[key] && S().prevKeys[key]; }
+bool IsKeyUp(int key) { return !IsKeyDown(key); }
+int GetKeyPressed(void) {
+	for (int key = 0; key < State::MaxKeys; ++key)
+		if (IsKeyPressed(key)) return key;
+	return 0;
+}
+int GetCharPressed(void) {
+	State& s = S();
+	return s.charRead < s.charCount ? s.chars[s.charRead++] : 0;
+}
+void SetExitKey(int) {}
+bool IsMouseButtonPressed(int button) { return ValidButton(button) && S().buttons[button] && !S().prevButtons[button]; }
+bool IsMouseButtonDown(int button) { return ValidButton(button) && S().buttons[button]; }
+bool IsMouseButtonReleased(int button) { return ValidButton(button) && !S().buttons[button] && S().prevButtons[button]; }
+bool IsMouseButtonUp(int button) { return !IsMouseButtonDown(button); }
+int GetMouseX(void) { return (int)S().mouse.x; }
+int GetMouseY(void) { return (int)S().mouse.y; }
+Vector2 GetMousePosition(void) { return S().mouse; }
+Vector2 GetMouseDelta(void) { return { S().mouse.x - S().prevMouse.x, S().mouse.y - S().prevMouse.y }; }
+float GetMouseWheelMove(void) { return fabsf(S().wheel.x) > fabsf(S().wheel.y) ? S().wheel.x : S().wheel.y; }
+Vector2 GetMouseWheelMoveV(void) { return S().wheel; }
+
+// --- Shapes ---
+void DrawLine(int, int, int, int, Color) { CountDraw(); }
+void DrawRectangle(int, int, int, int, Color) { CountDraw(); }
+void DrawRectangleRec(Rectangle, Color) { CountDraw(); }
+void DrawRectangleLinesEx(Rectangle, float, Color) { CountDraw(); }
+
+// --- Images ---
+int GetPixelDataSize(int width, int height, int format) {
+	int bpp = 4;
+	switch (format) {
+	case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 1; break;
+	case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+	case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+	case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 2; break;
+	case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 3; break;
+	case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 6; break;
+	case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 8; break;
+	case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 12; break;
+	case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 16; break;
+	default: break;
+	}
+	return width * height * bpp;
+}
+
+Image GenImageColor(int width, int height, Color color) {
+	Image image{ MemAlloc((unsigned int)(width * height * 4)), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+	for (int i = 0; i < width * height; ++i)
+		memcpy((unsigned char *)image.data + i * 4, &color, 4);
+	return image;
+}
+Image LoadImage(const char*) { return GenImageColor(1, 1, WHITE); }
+Image LoadImageFromMemory(const char*, const unsigned char*, int) { return GenImageColor(1, 1, WHITE); }
+void UnloadImage(Image image) { MemFree(image.data); }
+bool ExportImage(Image, const char*) { return true; }
+
+Image ImageCopy(Image image) {
+	int size = GetPixelDataSize(image.width, image.height, image.format);
+	Image copy = image;
+	copy.data = MemAlloc((unsigned int)size);
+	memcpy(copy.data, image.data, (size_t)size);
+	copy.mipmaps = 1;
+	return copy;
+}
+
+Image ImageFromImage(Image image, Rectangle rec) {
+	int bpp = GetPixelDataSize(1, 1, image.format);
+	int w = (int)rec.width, h = (int)rec.height;
+	Image out{ MemAlloc((unsigned int)(w * h * bpp)), w, h, 1, image.format };
+	for (int y = 0; y < h; ++y)
+		memcpy((unsigned char *)out.data + (size_t)y * w * bpp,
+			(unsigned char *)image.data + ((size_t)(y + (int)rec.y) * image.width + (int)rec.x) * bpp, (size_t)w * bpp);
+	return out;
+}
+
+// Only RGBA8 sources are converted (to the 8-bit formats); anything else is relabelled
+void ImageFormat(Image *image, int newFormat) {
+	if (image->format == newFormat || image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) { image->format = newFormat; return; }
+	int n = image->width * image->height;
+	int bpp = GetPixelDataSize(1, 1, newFormat);
+	unsigned char *src = (unsigned char *)image->data;
+	unsigned char *dst = (unsigned char *)MemAlloc((unsigned int)(n * bpp));
+	for (int i = 0; i < n; ++i) {
+		unsigned char *p = src + i * 4, *o = dst + i * bpp;
+		unsigned char gray = (unsigned char)(p[0] * 0.299f + p[1] * 0.587f + p[2] * 0.114f);
+		if (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) o[0] = gray;
+		else if (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) { o[0] = gray; o[1] = p[3]; }
+		else if (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) { o[0] = p[0]; o[1] = p[1]; o[2] = p[2]; }
+		else memcpy(o, p, (size_t)(bpp < 4 ? bpp : 4));
+	}
+	MemFree(src);
+	image->data = dst;
+	image->format = newFormat;
+}
+
+// Nearest-neighbour, RGBA8 only
+void ImageResize(Image *image, int newWidth, int newHeight) {
+	if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+	uint32_t *src = (uint32_t *)image->data;
+	uint32_t *dst = (uint32_t *)MemAlloc((unsigned int)(newWidth * newHeight * 4));
+	for (int y = 0; y < newHeight; ++y)
+		for (int x = 0; x < newWidth; ++x)
+			dst[y * newWidth + x] = src[(y * image->height / newHeight) * image->width + x * image->width / newWidth];
+	MemFree(src);
+	image->data = dst;
+	image->width = newWidth;
+	image->height = newHeight;
+}
+
+void ImageMipmaps(Image*) {}
+void ImageColorTint(Image*, Color) {}
+// Same per-channel math as raylib, for R8G8B8A8 images
+void ImageColorInvert(Image *image) {
+	unsigned char *p = (unsigned char *)image->data;
+	for (int i = 0; i < image->width * image->height; ++i)
+		for (int c = 0; c < 3; ++c) p[i * 4 + c] = 255 - p[i * 4 + c];
+}
+void ImageColorBrightness(Image *image, int brightness) {
+	if (brightness < -255) brightness = -255;
+	if (brightness > 255) brightness = 255;
+	unsigned char *p = (unsigned char *)image->data;
+	for (int i = 0; i < image->width * image->height; ++i)
+		for (int c = 0; c < 3; ++c) {
+			int v = p[i * 4 + c] + brightness;
+			p[i * 4 + c] = (unsigned char)(v < 0 ? 0 : v > 255 ? 255 : v);
+		}
+}
+void ImageBlurGaussian(Image*, int) {}
+void ImageDraw(Image*, Image, Rectangle, Rectangle, Color) {}
+
+Color GetImageColor(Image image, int x, int y) {
+	Color c{ 0, 0, 0, 0 };
+	if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 && x >= 0 && y >= 0 && x < image.width && y < image.height)
+		memcpy(&c, (unsigned char *)image.data + ((size_t)y * image.width + x) * 4, 4);
+	return c;
+}
+
+// --- Textures ---
+Texture2D LoadTextureFromImage(Image image) { return Texture2D{ S().nextId++, image.width, image.height, image.mipmaps, image.format }; }
+Texture2D LoadTexture(const char*) { return Texture2D{ S().nextId++, 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 }; }
+RenderTexture2D LoadRenderTexture(int width, int height) {
+	RenderTexture2D target{};
+	target.id = S().nextId++;
+	target.texture = Texture2D{ S().nextId++, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+	return target;
+}
+bool IsTextureValid(Texture2D texture) { return texture.id != 0; }
+void UnloadTexture(Texture2D) {}
+bool IsRenderTextureValid(RenderTexture2D target) { return target.id != 0; }
+void UnloadRenderTexture(RenderTexture2D) {}
+void UpdateTexture(Texture2D texture, const void *pixels) {
+	const unsigned char *p = (const unsigned char *)pixels;
+	S().lastUpload.assign(p, p + GetPixelDataSize(texture.width, texture.height, texture.format));
+}
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels) {
+	const unsigned char *p = (const unsigned char *)pixels;
+	S().lastUpload.assign(p, p + GetPixelDataSize((int)rec.width, (int)rec.height, texture.format));
+}
+void GenTextureMipmaps(Texture2D*) {}
+void SetTextureFilter(Texture2D, int) {}
+void DrawTexture(Texture2D, int, int, Color) { CountDraw(); }
+void DrawTextureV(Texture2D, Vector2, Color) { CountDraw(); }
+void DrawTextureRec(Texture2D, Rectangle, Vector2, Color) { CountDraw(); }
+void DrawTexturePro(Texture2D, Rectangle, Rectangle, Vector2, float, Color) { CountDraw(); }
+Color Fade(Color color, float alpha) { color.a = (unsigned char)(255.0f * (alpha < 0 ? 0 : alpha > 1 ? 1 : alpha)); return color; }
+Color ColorAlpha(Color color, float alpha) { return Fade(color, alpha); }
+
+// --- Fonts / text ---
+// Every glyph is a solid (fontSize / 2) x fontSize block; text measures at half the font size per character
+Font GetFontDefault(void) { return Font{ 10, 0, 0, {}, nullptr, nullptr }; }
+Font LoadFont(const char*) { return GetFontDefault(); }
+Font LoadFontEx(const char*, int fontSize, int*, int) { Font f = GetFontDefault(); f.baseSize = fontSize; return f; }
+Font LoadFontFromMemory(const char*, const unsigned char*, int, int fontSize, int*, int) { Font f = GetFontDefault(); f.baseSize = fontSize; return f; }
+
+GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int) {
+	// Only the sfnt signature is checked; glyphs are synthesized from the size
+	static const unsigned char TrueType[4] = { 0, 1, 0, 0 };
+	if (!fileData || dataSize < 4 || (memcmp(fileData, TrueType, 4) != 0 && memcmp(fileData, "OTTO", 4) != 0 && memcmp(fileData, "true", 4) != 0))
+		return nullptr;
+	for (int i = 0; i < codepointCount; ++i)
+		if (codepoints[i] == S().failingCodepoint) return nullptr;
+	GlyphInfo *glyphs = (GlyphInfo *)MemAlloc((unsigned int)(codepointCount * sizeof(GlyphInfo)));
+	for (int i = 0; i < codepointCount; ++i) {
+		int w = codepoints[i] == 32 ? 0 : fontSize / 2;
+		glyphs[i].value = codepoints[i];
+		glyphs[i].advanceX = fontSize / 2;
+		glyphs[i].image = Image{ w ? MemAlloc((unsigned int)(w * fontSize)) : nullptr, w, w ? fontSize : 0, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+		if (w) memset(glyphs[i].image.data, 200, (size_t)(w * fontSize));
+	}
+	return glyphs;
+}
+void UnloadFontData(GlyphInfo *glyphs, int glyphCount) {
+	for (int i = 0; i < glyphCount; ++i)
+		MemFree(glyphs[i].image.data);
+	MemFree(glyphs);
+}
+void UnloadFont(Font) {}
+void DrawText(const char*, int, int, int, Color) { CountDraw(); }
+void DrawTextEx(Font, const char*, Vector2, float, float, Color) { CountDraw(); }
+int MeasureText(const char *text, int fontSize) { return (int)(strlen(text) * fontSize / 2); }
+Vector2 MeasureTextEx(Font, const char *text, float fontSize, float spacing) {
+	size_t n = strlen(text);
+	return { n * fontSize * 0.5f + (n ? (n - 1) * spacing : 0.0f), fontSize };
+}
+int GetGlyphIndex(Font font, int codepoint) {
+	for (int i = 0; i < font.glyphCount; ++i)
+		if (font.glyphs && font.glyphs[i].value == codepoint) return i;
+	return 0;
+}
+int GetCodepointNext(const char *text, int *codepointSize) {
+	const unsigned char *p = (const unsigned char *)text;
+	int cp = 0x3f;
+	*codepointSize = 1;
+	if (p[0] < 0x80) cp = p[0];
+	else if ((p[0] & 0xe0) == 0xc0 && p[1]) { cp = ((p[0] & 0x1f) << 6) | (p[1] & 0x3f); *codepointSize = 2; }
+	else if ((p[0] & 0xf0) == 0xe0 && p[1] && p[2]) { cp = ((p[0] & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f); *codepointSize = 3; }
+	else if ((p[0] & 0xf8) == 0xf0 && p[1] && p[2] && p[3]) { cp = ((p[0] & 0x07) << 18) | ((p[1] & 0x3f) << 12) | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f); *codepointSize = 4; }
+	return cp;
+}
+
+// --- Models ---
+static Mesh MakeMesh(int vertexCount) {
+	Mesh mesh{};
+	mesh.vertexCount = vertexCount;
+	mesh.vertices = (float *)MemAlloc((unsigned int)(vertexCount * 3 * sizeof(float)));
+	return mesh;
+}
+// Unit-cube corners scaled to the requested extent, so bounding boxes are right
+static Mesh MakeBoxMesh(float w, float h, float l) {
+	Mesh mesh = MakeMesh(8);
+	for (int i = 0; i < 8; ++i) {
+		mesh.vertices[i * 3 + 0] = (i & 1 ? 0.5f : -0.5f) * w;
+		mesh.vertices[i * 3 + 1] = (i & 2 ? 0.5f : -0.5f) * h;
+		mesh.vertices[i * 3 + 2] = (i & 4 ? 0.5f : -0.5f) * l;
+	}
+	return mesh;
+}
+void UploadMesh(Mesh*, bool) {}
+void UnloadMesh(Mesh mesh) { MemFree(mesh.vertices); }
+void DrawMesh(Mesh, Material, Matrix) { CountDraw(); }
+void DrawMeshInstanced(Mesh, Material, const Matrix*, int) { CountDraw(); }
+BoundingBox GetMeshBoundingBox(Mesh mesh) {
+	BoundingBox box{ { 0, 0, 0 }, { 0, 0, 0 } };
+	for (int i = 0; i < mesh.vertexCount; ++i) {
+		const float *v = mesh.vertices + i * 3;
+		if (i == 0 || v[0] < box.min.x) box.min.x = v[0];
+		if (i == 0 || v[1] < box.min.y) box.min.y = v[1];
+		if (i == 0 || v[2] < box.min.z) box.min.z = v[2];
+		if (i == 0 || v[0] > box.max.x) box.max.x = v[0];
+		if (i == 0 || v[1] > box.max.y) box.max.y = v[1];
+		if (i == 0 || v[2] > box.max.z) box.max.z = v[2];
+	}
+	return box;
+}
+Mesh GenMeshPoly(int, float radius) { return MakeBoxMesh(radius * 2, 0.0f, radius * 2); }
+Mesh GenMeshPlane(float width, float length, int, int) { return MakeBoxMesh(width, 0.0f, length); }
+Mesh GenMeshCube(float width, float height, float length) { return MakeBoxMesh(width, height, length); }
+Mesh GenMeshSphere(float radius, int, int) { return MakeBoxMesh(radius * 2, radius * 2, radius * 2); }
+Mesh GenMeshCylinder(float radius, float height, int) { return MakeBoxMesh(radius * 2, height, radius * 2); }
+Mesh GenMeshCone(float radius, float height, int) { return MakeBoxMesh(radius * 2, height, radius * 2); }
+
+Material LoadMaterialDefault(void) {
+	Material material{};
+	material.maps = (MaterialMap *)MemAlloc(12 * sizeof(MaterialMap));
+	return material;
+}
+void UnloadMaterial(Material material) { MemFree(material.maps); }
+
+Model LoadModelFromMesh(Mesh mesh) {
+	Model model{};
+	model.transform = Matrix{ 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+	model.meshCount = 1;
+	model.meshes = (Mesh *)MemAlloc(sizeof(Mesh));
+	model.meshes[0] = mesh;
+	model.materialCount = 1;
+	model.materials = (Material *)MemAlloc(sizeof(Material));
+	model.materials[0] = LoadMaterialDefault();
+	model.meshMaterial = (int *)MemAlloc(sizeof(int));
+	return model;
+}
+Model LoadModel(const char*) { return LoadModelFromMesh(GenMeshCube(1.0f, 1.0f, 1.0f)); }
+void UnloadModel(Model model) {
+	for (int i = 0; i < model.meshCount; ++i) UnloadMesh(model.meshes[i]);
+	for (int i = 0; i < model.materialCount; ++i) UnloadMaterial(model.materials[i]);
+	MemFree(model.meshes);
+	MemFree(model.materials);
+	MemFree(model.meshMaterial);
+}
+
+// --- Shaders ---
+Shader LoadShader(const char*, const char*) { return Shader{ S().nextId++, nullptr }; }
+void UnloadShader(Shader) {}
+
+// --- Audio (no device; sounds report playing until stopped) ---
+static rAudioBuffer *NewAudioHandle() { return (rAudioBuffer *)(intptr_t)(S().nextId++); }
+void InitAudioDevice(void) {}
+void CloseAudioDevice(void) {}
+bool IsAudioDeviceReady(void) { return true; }
+Wave LoadWave(const char*) { return Wave{ 10, 44100, 16, 1, MemAlloc(20) }; }
+Wave LoadWaveFromMemory(const char*, const unsigned char*, int) { return Wave{ 10, 44100, 16, 1, MemAlloc(20) }; }
+void UnloadWave(Wave wave) { MemFree(wave.data); }
+Sound LoadSoundFromWave(Wave wave) { Sound s{}; s.stream.buffer = NewAudioHandle(); s.frameCount = wave.frameCount; return s; }
+Sound LoadSound(const char*) { Sound s{}; s.stream.buffer = NewAudioHandle(); return s; }
+Sound LoadSoundAlias(Sound source) { Sound s = source; s.stream.buffer = NewAudioHandle(); return s; }
+void UnloadSound(Sound sound) { S().playing.erase(sound.stream.buffer); }
+void UnloadSoundAlias(Sound alias) { S().playing.erase(alias.stream.buffer); }
+void PlaySound(Sound sound) { S().playing[sound.stream.buffer] = true; }
+void StopSound(Sound sound) { S().playing[sound.stream.buffer] = false; }
+void PauseSound(Sound sound) { S().playing[sound.stream.buffer] = false; }
+void ResumeSound(Sound sound) { S().playing[sound.stream.buffer] = true; }
+bool IsSoundPlaying(Sound sound) { auto it = S().playing.find(sound.stream.buffer); return it != S().playing.end() && it->second; }
+void SetSoundVolume(Sound, float) {}
+void SetSoundPitch(Sound, float) {}
+void SetSoundPan(Sound, float) {}
+Music LoadMusicStream(const char*) { Music m{}; m.stream.buffer = NewAudioHandle(); return m; }
+Music LoadMusicStreamFromMemory(const char*, const unsigned char*, int) { Music m{}; m.stream.buffer = NewAudioHandle(); return m; }
+void UnloadMusicStream(Music) {}
+void PlayMusicStream(Music) {}
+bool IsMusicStreamPlaying(Music) { return false; }
+void UpdateMusicStream(Music) {}
+void StopMusicStream(Music) {}
+AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels) {
+	AudioStream stream{ NewAudioHandle(), nullptr, sampleRate, sampleSize, channels };
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	// Sized like raylib: the current default, or a 48 kHz device's sampleRate/30
+	s.streams[stream.buffer].frames = s.bufferSizeDefault > 0 ? s.bufferSizeDefault : 48000 / 30;
+	return stream;
+}
+void UnloadAudioStream(AudioStream stream) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	s.streams.erase(stream.buffer);
+}
+void UpdateAudioStream(AudioStream stream, const void*, int frameCount) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	auto it = s.streams.find(stream.buffer);
+	if (it == s.streams.end()) return;
+	++it->second.updates;
+	it->second.lastFrameCount = frameCount;
+}
+// Nothing plays the buffers back, so only the two initially free halves ever need data
+bool IsAudioStreamProcessed(AudioStream stream) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	auto it = s.streams.find(stream.buffer);
+	return it != s.streams.end() && it->second.updates < 2;
+}
+void PlayAudioStream(AudioStream) {}
+void StopAudioStream(AudioStream) {}
+bool IsAudioStreamPlaying(AudioStream) { return true; }
+void SetAudioStreamBufferSizeDefault(int size) {
+	State& s = S();
+	std::lock_guard<std::mutex> lock(s.audioMutex);
+	s.bufferSizeDefault = size;
+}
+
+// --- rlgl ---
+void rlBegin(int) {}
+void rlEnd(void) { CountDraw(); }
+void rlVertex2f(float, float) {}
+void rlVertex3f(float, float, float) {}
+void rlTexCoord2f(float, float) {}
+void rlNormal3f(float, float, float) {}
+void rlColor4ub(unsigned char, unsigned char, unsigned char, unsigned char) {}
+void rlSetTexture(unsigned int) {}
+bool rlCheckRenderBatchLimit(int) { return false; }
+void rlDrawRenderBatchActive(void) {}
+unsigned int rlGetTextureIdDefault(void) { return 1; }
+
+}
@@ -0,0 +1,87 @@
+// Headless raymath subset used by raylib_include.h (same definitions as raymath 5.x)
+#ifndef RAYMATH_H
+#define RAYMATH_H
+#include <math.h>
+#define RMAPI static inline
+RMAPI Vector3 Vector3Subtract(Vector3 a, Vector3 b) { return (Vector3){ a.x - b.x, a.y - b.y, a.z - b.z }; }
+RMAPI Vector3 Vector3Add(Vector3 a, Vector3 b) { return (Vector3){ a.x + b.x, a.y + b.y, a.z + b.z }; }
+RMAPI float Vector3Length(Vector3 v) { return sqrtf(v.x*v.x + v.y*v.y + v.z*v.z); }
+RMAPI Vector2 Vector2Add(Vector2 a, Vector2 b) { return (Vector2){ a.x + b.x, a.y + b.y }; }
+RMAPI Vector2 Vector2Subtract(Vector2 a, Vector2 b) { return (Vector2){ a.x - b.x, a.y - b.y }; }
+RMAPI Matrix MatrixIdentity(void) { return (Matrix){ 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 }; }
+RMAPI Matrix MatrixTranslate(float x, float y, float z) { return (Matrix){ 1,0,0,x, 0,1,0,y, 0,0,1,z, 0,0,0,1 }; }
+RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
+{
+	Matrix r;
+	r.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+	r.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+	r.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+	r.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+	r.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+	r.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+	r.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+	r.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+	r.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+	r.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+	r.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+	r.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+	r.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+	r.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+	r.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+	r.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+	return r;
+}
+RMAPI Matrix MatrixPerspective(double fovY, double aspect, double nearPlane, double farPlane)
+{
+	Matrix result = { 0 };
+	double top = nearPlane*tan(fovY*0.5);
+	double bottom = -top;
+	double right = top*aspect;
+	double left = -right;
+	float rl = (float)(right - left);
+	float tb = (float)(top - bottom);
+	float fn = (float)(farPlane - nearPlane);
+	result.m0 = ((float)nearPlane*2.0f)/rl;
+	result.m5 = ((float)nearPlane*2.0f)/tb;
+	result.m8 = ((float)right + (float)left)/rl;
+	result.m9 = ((float)top + (float)bottom)/tb;
+	result.m10 = -((float)farPlane + (float)nearPlane)/fn;
+	result.m11 = -1.0f;
+	result.m14 = -((float)farPlane*(float)nearPlane*2.0f)/fn;
+	return result;
+}
+RMAPI Matrix MatrixLookAt(Vector3 eye, Vector3 target, Vector3 up)
+{
+	Matrix result = { 0 };
+	float length;
+	float ilength;
+	Vector3 vz = { eye.x - target.x, eye.y - target.y, eye.z - target.z };
+	Vector3 v = vz; length = sqrtf(v.x*v.x + v.y*v.y + v.z*v.z); if (length == 0.0f) length = 1.0f; ilength = 1.0f/length;
+	vz.x *= ilength; vz.y *= ilength; vz.z *= ilength;
+	Vector3 vx = { up.y*vz.z - up.z*vz.y, up.z*vz.x - up.x*vz.z, up.x*vz.y - up.y*vz.x };
+	v = vx; length = sqrtf(v.x*v.x + v.y*v.y + v.z*v.z); if (length == 0.0f) length = 1.0f; ilength = 1.0f/length;
+	vx.x *= ilength; vx.y *= ilength; vx.z *= ilength;
+	Vector3 vy = { vz.y*vx.z - vz.z*vx.y, vz.z*vx.x - vz.x*vx.z, vz.x*vx.y - vz.y*vx.x };
+	result.m0 = vx.x; result.m1 = vy.x; result.m2 = vz.x; result.m3 = 0.0f;
+	result.m4 = vx.y; result.m5 = vy.y; result.m6 = vz.y; result.m7 = 0.0f;
+	result.m8 = vx.z; result.m9 = vy.z; result.m10 = vz.z; result.m11 = 0.0f;
+	result.m12 = -(vx.x*eye.x + vx.y*eye.y + vx.z*eye.z);
+	result.m13 = -(vy.x*eye.x + vy.y*eye.y + vy.z*eye.z);
+	result.m14 = -(vz.x*eye.x + vz.y*eye.y + vz.z*eye.z);
+	result.m15 = 1.0f;
+	return result;
+}
+RMAPI Matrix MatrixOrtho(double left, double right, double bottom, double top, double nearPlane, double farPlane)
+{
+	Matrix result = { 0 };
+	float lr = (float)(right - left);
+	float tb = (float)(top - bottom);
+	float fn = (float)(farPlane - nearPlane);
+	result.m0 = 2.0f/lr; result.m5 = 2.0f/tb; result.m10 = -2.0f/fn;
+	result.m12 = -((float)left + (float)right)/lr;
+	result.m13 = -((float)top + (float)bottom)/tb;
+	result.m14 = -((float)farPlane + (float)nearPlane)/fn;
+	result.m15 = 1.0f;
+	return result;
+}
+#endif
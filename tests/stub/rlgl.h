@@ -0,0 +1,24 @@
+// Headless rlgl subset: immediate-mode calls are accepted and discarded
+#ifndef RLGL_H
+#define RLGL_H
+#define RL_LINES 0x0001
+#define RL_TRIANGLES 0x0004
+#define RL_QUADS 0x0007
+#if defined(__cplusplus)
+extern "C" {
+#endif
+void rlBegin(int mode);
+void rlEnd(void);
+void rlVertex2f(float x, float y);
+void rlVertex3f(float x, float y, float z);
+void rlTexCoord2f(float x, float y);
+void rlNormal3f(float x, float y, float z);
+void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+void rlSetTexture(unsigned int id);
+bool rlCheckRenderBatchLimit(int vCount);
+void rlDrawRenderBatchActive(void);
+unsigned int rlGetTextureIdDefault(void);
+#if defined(__cplusplus)
+}
+#endif
+#endif
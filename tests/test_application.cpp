@@ -0,0 +1,108 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	struct Counters {
+		int shown = 0;
+		int updates = 0;
+		int renders = 0;
+		int before = 0;
+		int after = 0;
+		std::pmr::memory_resource* frameMemory = nullptr;
+	};
+
+	class CountingLayer : public Core::Layer {
+	public:
+		explicit CountingLayer(Counters& counters) : m_counters(counters) { Identifier = "counting"; }
+
+		void OnShow() override { ++m_counters.shown; }
+		void OnUpdate() override {
+			++m_counters.updates;
+			m_counters.frameMemory = FrameMemory;
+			std::pmr::vector<int> scratch(FrameMemory);
+			scratch.resize(256);
+		}
+		void OnRender() override { ++m_counters.renders; }
+		void OnRender_Before_Unscaled() override { ++m_counters.before; }
+		void OnRender_After_Unscaled() override { ++m_counters.after; }
+
+	private:
+		Counters& m_counters;
+	};
+
+	void RunFrames(int frames) {
+		HeadlessSetFrameLimit(frames);
+		Core::Application::Run();
+	}
+}
+
+TEST(Application, RunsLayersOncePerFrame)
+{
+	Counters counters;
+	Core::Application::InitializeComponents(320, 240, "test");
+	Core::Application::Add<CountingLayer>(counters);
+	RunFrames(5);
+
+	CHECK_EQ(counters.shown, 1);
+	CHECK_EQ(counters.updates, 5);
+	CHECK_EQ(counters.renders, 5);
+	CHECK_EQ(counters.before, 0);
+	CHECK(counters.frameMemory == Core::Application::GetFrameResource());
+	CHECK_THROWS(Core::Application::Add<CountingLayer>(counters), std::invalid_argument);
+	Core::Application::Remove<CountingLayer>();
+}
+
+TEST(Application, FrameArenaResetsEveryFrame)
+{
+	Counters counters;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<CountingLayer>(counters);
+	const uint64_t startFrame = Core::Application::GetFrameArenaStats().frame;
+	RunFrames(8);
+
+	const rlx::FrameArenaStats& stats = Core::Application::GetFrameArenaStats();
+	CHECK_EQ(stats.frame - startFrame, uint64_t(8));
+	CHECK(stats.frameBytes >= 256 * sizeof(int));
+	CHECK(stats.frameBytes < 4 * 256 * sizeof(int));	// one frame's worth, not accumulated
+	CHECK_EQ(stats.frameFallbacks, size_t(0));
+	Core::Application::Remove<CountingLayer>();
+}
+
+TEST(Application, UpscaledRenderCallsUnscaledHooks)
+{
+	Counters counters;
+	auto& app = Core::Application::Instance();
+	Core::Application::InitializeComponents();
+	Core::Application::Add<CountingLayer>(counters);
+	app.UpscaleTexture = rlx::Managed<RenderTexture2D>(160, 120);
+	app.UpscaleEnabled = true;
+	app.UpscaleFactor = 2;
+	RunFrames(3);
+
+	CHECK_EQ(counters.renders, 3);
+	CHECK_EQ(counters.before, 3);
+	CHECK_EQ(counters.after, 3);
+	rlRectangle area = Core::Application::GetUpscaledRenderArea();
+	CHECK(area.width > 0.0f);
+
+	app.UpscaleEnabled = false;
+	Core::Application::Remove<CountingLayer>();
+}
+
+TEST(Application, CustomLoopReplacesLayers)
+{
+	Counters counters;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<CountingLayer>(counters);
+	int loops = 0;
+	HeadlessSetFrameLimit(4);
+	Core::Application::Run([&]() {
+		++loops;
+		BeginDrawing();
+		EndDrawing();
+	});
+	CHECK_EQ(loops, 4);
+	CHECK_EQ(counters.updates, 0);
+	Core::Application::Remove<CountingLayer>();
+}
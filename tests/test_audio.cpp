@@ -0,0 +1,141 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+TEST(Audio, RingBufferWrapsAround)
+{
+	rlx::SpscRingBuffer<int> ring(5);	// rounded up to 8
+	CHECK_EQ(ring.Capacity(), size_t(8));
+
+	int in[6] = { 1, 2, 3, 4, 5, 6 };
+	int out[8] = {};
+	for (int round = 0; round < 4; ++round) {
+		CHECK_EQ(ring.Push(in, 6), size_t(6));
+		CHECK_EQ(ring.Available(), size_t(2));
+		CHECK_EQ(ring.Push(in, 6), size_t(2));
+		CHECK_EQ(ring.Pop(out, 8), size_t(8));
+		CHECK_EQ(out[5], 6);
+		CHECK_EQ(out[7], 2);
+		CHECK(ring.Empty());
+	}
+}
+
+TEST(Audio, RingBufferAcrossThreads)
+{
+	rlx::SpscRingBuffer<uint32_t> ring(1024);
+	constexpr uint32_t total = 200000;
+	std::thread producer([&] {
+		uint32_t next = 0;
+		while (next < total) {
+			uint32_t batch[64];
+			uint32_t n = std::min<uint32_t>(64, total - next);
+			for (uint32_t i = 0; i < n; ++i) batch[i] = next + i;
+			next += static_cast<uint32_t>(ring.Push(batch, n));
+		}
+	});
+
+	uint32_t expected = 0;
+	bool ordered = true;
+	while (expected < total) {
+		uint32_t batch[97];
+		size_t got = ring.Pop(batch, 97);
+		for (size_t i = 0; i < got; ++i)
+			ordered &= batch[i] == expected++;
+	}
+	producer.join();
+	CHECK(ordered);
+}
+
+TEST(Audio, MixerAppliesGainAndPan)
+{
+	rlx::AudioMixer mixer(64);
+	size_t a = mixer.AddSource(64);
+	size_t b = mixer.AddSource(64);
+	std::vector<float> ones(32 * 2, 0.25f);
+	mixer.Push(a, ones.data(), 32);
+	mixer.Push(b, ones.data(), 32);
+	mixer.SetGain(a, 2.0f);
+	mixer.SetPan(b, 0.0f);	// hard left
+
+	std::vector<float> out(32 * 2);
+	mixer.Mix(out.data(), 32);
+	CHECK_NEAR(out[0], 0.75f, 1e-6);	// 0.5 + 0.25
+	CHECK_NEAR(out[1], 0.5f, 1e-6);	// right channel only gets source a
+	CHECK_EQ(mixer.GetTotalUnderruns(), uint64_t(0));
+
+	mixer.Mix(out.data(), 32);
+	CHECK_EQ(out[0], 0.0f);
+	CHECK_EQ(mixer.GetTotalUnderruns(), uint64_t(2));
+	CHECK_THROWS(mixer.Mix(out.data(), 65), std::invalid_argument);
+}
+
+TEST(Audio, MixerClampsOutput)
+{
+	rlx::AudioMixer mixer(16);
+	size_t s = mixer.AddSource(16);
+	std::vector<float> loud(16 * 2, 0.9f);
+	mixer.Push(s, loud.data(), 16);
+	mixer.SetGain(s, 4.0f);
+	std::vector<float> out(16 * 2);
+	mixer.Mix(out.data(), 16);
+	CHECK_EQ(out[0], 1.0f);
+	CHECK_EQ(out[31], 1.0f);
+}
+
+TEST(Audio, SoundPoolStealsLowestPriority)
+{
+	Wave wave = LoadWave("beep.wav");
+	rlx::SoundPool pool(wave, 4, 2);
+	UnloadWave(wave);
+
+	int first = pool.Play(1);
+	int second = pool.Play(5);
+	CHECK(first >= 0 && second >= 0 && first != second);
+	CHECK_EQ(pool.GetActiveVoices(), 2);
+
+	int third = pool.Play(3);	// over the concurrency cap: replaces priority 1
+	CHECK_EQ(third, first);
+	CHECK_EQ(pool.GetStolenCount(), uint64_t(1));
+
+	CHECK_EQ(pool.Play(0), -1);	// lower than everything playing
+	CHECK_EQ(pool.GetRejectedCount(), uint64_t(1));
+
+	pool.StopAll();
+	CHECK_EQ(pool.GetActiveVoices(), 0);
+}
+
+TEST(Audio, FeederWritesEachStreamItsOwnBufferSize)
+{
+	rlx::AudioFeederConfig config;
+	config.framesPerBuffer = 256;
+	config.defaultBufferFrames = 0;
+	config.pollInterval = std::chrono::microseconds(100);
+
+	SetAudioStreamBufferSizeDefault(512);
+	rlx::Managed<AudioStream> older(48000, 32, 2);	// loaded before the feeder, keeps 512
+	SetAudioStreamBufferSizeDefault(0);
+
+	rlx::AudioFeeder feeder(config);
+	feeder.AddSource();
+	rlx::Managed<AudioStream> sized = feeder.LoadStream(1);
+	CHECK_EQ(HeadlessGetAudioStreamFrames(sized, nullptr), 256);
+	CHECK_EQ(HeadlessGetAudioBufferSizeDefault(), 0);
+	CHECK_THROWS(feeder.AddStream(older, 0), std::invalid_argument);
+	size_t a = feeder.AddStream(older, 512);
+	size_t b = feeder.AddStream(sized, feeder.GetConfig().framesPerBuffer);
+
+	feeder.Start();
+	CHECK_EQ(HeadlessGetAudioBufferSizeDefault(), 0);	// the mixer output did not leak its size
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while ((HeadlessGetAudioStreamUpdates(older) < 2 || HeadlessGetAudioStreamUpdates(sized) < 2) && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	feeder.Stop();
+
+	int last = 0;
+	CHECK_EQ(HeadlessGetAudioStreamFrames(older, &last), 512);
+	CHECK_EQ(last, 512);
+	CHECK_EQ(HeadlessGetAudioStreamFrames(sized, &last), 256);
+	CHECK_EQ(last, 256);
+	CHECK_EQ(feeder.GetStreamUnderruns(a), uint64_t(2));
+	CHECK_EQ(feeder.GetStreamUnderruns(b), uint64_t(2));
+}
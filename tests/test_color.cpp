@@ -0,0 +1,37 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+TEST(Color, RgbPackedFormats)
+{
+	rlx::RGB c(255, 128, 64);
+	CHECK_EQ((uint32_t)c, 0x004080FFu);
+	CHECK_EQ((uint16_t)c, (uint16_t)((31 << 11) | (32 << 5) | 8));
+	CHECK_EQ((uint8_t)c, (uint8_t)(0xE0 | 0x10 | 0x01));
+}
+
+TEST(Color, RgbToRaylibColor)
+{
+	Color c = rlx::RGB(1, 2, 3);
+	CHECK_EQ(c.r, 1);
+	CHECK_EQ(c.g, 2);
+	CHECK_EQ(c.b, 3);
+	CHECK_EQ(c.a, 255);
+}
+
+TEST(Color, RgbaRoundTrip)
+{
+	rlx::RGBA c(10, 20, 30, 40);
+	CHECK_EQ((uint32_t)c, 0x281E140Au);
+	Color raw = c;
+	CHECK_EQ(raw.r, 10);
+	CHECK_EQ(raw.a, 40);
+}
+
+TEST(Color, ExtremesSaturatePackedChannels)
+{
+	rlx::RGBA white(255, 255, 255, 255);
+	rlx::RGBA black(0, 0, 0, 0);
+	CHECK_EQ((uint16_t)white, 0xFFFF);
+	CHECK_EQ((uint8_t)white, 0xFF);
+	CHECK_EQ((uint32_t)black, 0u);
+}
@@ -0,0 +1,120 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	// Scripted time like the FramePacer tests. Every wait is logged to the stub's event log as one 'w',
+	// next to its 's' swap and 'p' poll entries.
+	class MarkingClock : public rlx::FrameClock {
+	public:
+		double Now() override { return time; }
+		void Sleep(double seconds) override {
+			Mark();
+			time += seconds + jitter;
+		}
+		void Relax() override {
+			Mark();
+			time += 0.00001;
+		}
+
+		double time = 100.0;
+		double jitter = 0.0005;
+
+	private:
+		static void Mark() {
+			const std::string events = HeadlessGetEvents();
+			if (events.empty() || events.back() != 'w')
+				HeadlessMark('w');
+		}
+	};
+
+	// Logs 'u' when it reads input and spends work seconds of scripted time
+	class WorkLayer : public Core::Layer {
+	public:
+		WorkLayer(MarkingClock& clock, double work) : m_clock(clock), m_work(work) { Identifier = "work"; }
+		void OnUpdate() override {
+			HeadlessMark('u');
+			m_clock.time += m_work;
+		}
+		void OnRender() override {}
+
+	private:
+		MarkingClock& m_clock;
+		double m_work;
+	};
+
+	const rlx::FramePacerStats& RunFrames(rlx::FramePacer::Mode mode, int frames) {
+		Core::Application::SetFramePacing(mode, 100.0);
+		Core::Application::GetFramePacer().ResetStats();
+		HeadlessResetCounters();
+		HeadlessSetFrameLimit(frames);
+		Core::Application::Run();
+		return Core::Application::GetFramePacerStats();
+	}
+
+	// Between two updates: a wait, then the swap, then the poll, and no wait after the poll
+	void CheckWaitBeforeSwapAndPoll(const std::string& events) {
+		size_t updates = 0;
+		size_t begin = events.find('u');
+		while (begin != std::string::npos) {
+			const size_t end = events.find('u', begin + 1);
+			if (end == std::string::npos) break;
+			const std::string between = events.substr(begin + 1, end - begin - 1);
+			const size_t wait = between.find('w');
+			const size_t swap = between.find('s');
+			const size_t poll = between.rfind('p');
+			CHECK(wait != std::string::npos && swap != std::string::npos && poll != std::string::npos);
+			CHECK(wait < swap);
+			CHECK(swap < poll);
+			CHECK(between.find('w', poll) == std::string::npos);
+			++updates;
+			begin = end;
+		}
+		CHECK(updates > 0);
+	}
+}
+
+TEST(CustomFrameControl, PacerWaitsBeforeSwapAndPoll)
+{
+	MarkingClock clock;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<WorkLayer>(clock, 0.002);
+	Core::Application::GetFramePacer().SetClock(&clock);
+
+	const rlx::FramePacerStats& hybrid = RunFrames(rlx::FramePacer::Mode::Hybrid, 10);
+	CHECK(Core::Application::GetFramePacer().GetMode() == rlx::FramePacer::Mode::Hybrid);
+	CHECK_EQ(hybrid.frames, uint64_t(10));
+	CHECK(hybrid.lastInputLatency > 0.009);	// input polled right after the previous present
+	CheckWaitBeforeSwapAndPoll(HeadlessGetEvents());
+
+	const rlx::FramePacerStats& jit = RunFrames(rlx::FramePacer::Mode::JustInTime, 10);
+	CHECK(Core::Application::GetFramePacer().GetMode() == rlx::FramePacer::Mode::JustInTime);
+	CHECK_EQ(jit.frames, uint64_t(10));
+	CHECK(jit.missedDeadlines <= 1);
+	CHECK(jit.lastInputLatency < 0.01);
+	CHECK(jit.lastInputLatency < 0.002 + Core::Application::GetFramePacer().GetJustInTimeHeadroom() + 0.001);
+	CheckWaitBeforeSwapAndPoll(HeadlessGetEvents());
+	CHECK_NEAR(rlx::Input::GetFrameTime(), 0.01f, 1e-3f);	// dt comes from the pacer
+
+	Core::Application::Remove<WorkLayer>();
+	Core::Application::SetFramePacing(rlx::FramePacer::Mode::Off);
+	Core::Application::GetFramePacer().SetClock(nullptr);
+}
+
+TEST(CustomFrameControl, OffLeavesTheLoopUncapped)
+{
+	MarkingClock clock;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<WorkLayer>(clock, 0.002);
+	Core::Application::GetFramePacer().SetClock(&clock);
+	Core::Application::SetTargetFPS(30);	// raylib's limiter lives in EndDrawing, which no longer waits
+
+	const rlx::FramePacerStats& stats = RunFrames(rlx::FramePacer::Mode::Off, 5);
+	CHECK_EQ(stats.frames, uint64_t(5));
+	CHECK_NEAR(stats.meanFrameTime, 0.002, 1e-9);
+	CHECK(std::string(HeadlessGetEvents()).find('w') == std::string::npos);
+
+	Core::Application::Remove<WorkLayer>();
+	Core::Application::SetTargetFPS(0);
+	Core::Application::GetFramePacer().SetClock(nullptr);
+}
@@ -0,0 +1,60 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+namespace {
+	// Fresh directory under the system temp path, removed on scope exit
+	struct TempDir {
+		std::filesystem::path path;
+		TempDir() {
+			path = std::filesystem::temp_directory_path() / ("rlx_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+			std::filesystem::create_directories(path);
+		}
+		~TempDir() { std::error_code ec; std::filesystem::remove_all(path, ec); }
+	};
+
+	void Touch(const std::filesystem::path& p) { std::ofstream(p) << "x"; }
+}
+
+TEST(Directory, ListsFilesAndDirectories)
+{
+	TempDir dir;
+	Touch(dir.path / "a.txt");
+	Touch(dir.path / "b.png");
+	CHECK(rlx::Directory::Create(dir.path / "sub"));
+
+	CHECK_EQ(rlx::Directory::GetFiles(dir.path).size(), size_t(2));
+	CHECK_EQ(rlx::Directory::GetDirectories(dir.path).size(), size_t(1));
+	auto png = rlx::Directory::GetFilesWithExtension(dir.path, ".png");
+	REQUIRE(png.size() == 1);
+	CHECK_EQ(png[0].filename().string(), std::string("b.png"));
+}
+
+TEST(Directory, MemoryResourceOverloads)
+{
+	TempDir dir;
+	for (int i = 0; i < 4; ++i)
+		Touch(dir.path / (std::to_string(i) + ".bin"));
+
+	rlx::FrameArena arena(4096);
+	auto files = rlx::Directory::GetFiles(dir.path, &arena);
+	CHECK_EQ(files.size(), size_t(4));
+	CHECK(files.get_allocator().resource() == &arena);
+	CHECK(arena.GetStats().frameBytes > 0);
+	CHECK_EQ(rlx::Directory::GetFilesWithExtension(dir.path, ".bin", &arena).size(), size_t(4));
+	CHECK(rlx::Directory::GetDirectories(dir.path, &arena).empty());
+}
+
+TEST(Directory, FileOperations)
+{
+	TempDir dir;
+	auto a = dir.path / "a.txt";
+	auto b = dir.path / "b.txt";
+	Touch(a);
+	CHECK(rlx::File::Exists(a));
+	CHECK(rlx::File::Copy(a, b));
+	CHECK_THROWS(rlx::File::Copy(a, b), std::filesystem::filesystem_error);
+	rlx::File::Move(b, dir.path / "c.txt", true);
+	CHECK(!rlx::File::Exists(b));
+	CHECK(rlx::File::Delete(dir.path / "c.txt"));
+	CHECK(rlx::Directory::Exists(dir.path));
+}
@@ -0,0 +1,104 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+namespace {
+	struct Position { float x, y; };
+	struct Velocity { float x, y; };
+}
+
+TEST(Ecs, CreateQueryDestroy)
+{
+	Core::Registry world;
+	std::vector<Core::Entity> entities;
+	for (int i = 0; i < 1000; ++i)
+		entities.push_back(world.Create(Position{ (float)i, 0.0f }, Velocity{ 1.0f, 2.0f }));
+	for (int i = 0; i < 500; ++i)
+		world.Create(Position{ 0.0f, 0.0f });
+
+	CHECK_EQ(world.Size(), size_t(1500));
+	CHECK_EQ((world.Count<Position>()), size_t(1500));
+	CHECK_EQ((world.Count<Position, Velocity>()), size_t(1000));
+
+	world.Each<Position, Velocity>([](Position& p, Velocity& v) { p.x += v.x; p.y += v.y; });
+	CHECK_EQ(world.Get<Position>(entities[10])->x, 11.0f);
+
+	world.Destroy(entities[10]);
+	CHECK(!world.IsAlive(entities[10]));
+	CHECK(world.Get<Position>(entities[10]) == nullptr);
+	Core::Entity reused = world.Create(Position{});
+	CHECK_EQ(reused.index, entities[10].index);
+	CHECK(reused.generation != entities[10].generation);
+}
+
+TEST(Ecs, AddRemoveMigratesComponents)
+{
+	Core::Registry world;
+	Core::Entity e = world.Create(Position{ 3.0f, 4.0f });
+	world.Add<Velocity>(e, Velocity{ 5.0f, 6.0f });
+	CHECK((world.Has<Position>(e) && world.Has<Velocity>(e)));
+	CHECK_EQ(world.Get<Position>(e)->y, 4.0f);
+
+	world.Remove<Position>(e);
+	CHECK(!world.Has<Position>(e));
+	CHECK_EQ(world.Get<Velocity>(e)->x, 5.0f);
+	CHECK(world.GetArchetypeCount() >= 3);
+}
+
+TEST(Ecs, ParallelEachVisitsEveryEntity)
+{
+	Core::Registry world;
+	for (int i = 0; i < 20000; ++i)
+		world.Create(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 0.0f });
+	rlx::ThreadPool pool(2);
+	world.ParallelEach<Position, Velocity>([](Position& p, Velocity& v) { p.x += v.x; }, pool);
+
+	size_t moved = 0;
+	world.Each<Position>([&](Core::Entity, Position& p) { moved += p.x == 1.0f; });
+	CHECK_EQ(moved, size_t(20000));
+}
+
+TEST(Ecs, ChurnAtChunkBoundaryKeepsSpareChunk)
+{
+	Core::Registry world;
+	std::vector<Core::Entity> entities;
+	while (world.GetChunkCount() < 2)
+		entities.push_back(world.Create(Position{ 1.0f, 0.0f }));
+	const size_t perChunk = entities.size() - 1;	// the last create opened the second chunk
+
+	// Dropping back under the boundary keeps the emptied chunk; re-crossing it reuses it
+	for (int i = 0; i < 100; ++i) {
+		world.Destroy(entities.back());
+		entities.pop_back();
+		CHECK_EQ(world.GetChunkCount(), size_t(2));
+		CHECK_EQ((world.Count<Position>()), perChunk);
+		size_t visited = 0;
+		world.Each<Position>([&](Position& p) { visited += p.x == 1.0f; });
+		CHECK_EQ(visited, perChunk);
+		entities.push_back(world.Create(Position{ 1.0f, 0.0f }));
+	}
+
+	// Emptying a second chunk releases one of them, leaving a single spare
+	while (world.GetChunkCount() < 3)
+		entities.push_back(world.Create(Position{ 1.0f, 0.0f }));
+	while (entities.size() > perChunk / 2) {
+		world.Destroy(entities.back());
+		entities.pop_back();
+	}
+	CHECK_EQ(world.GetChunkCount(), size_t(2));
+	world.Clear();
+	CHECK_EQ(world.GetChunkCount(), size_t(0));
+}
+
+TEST(Ecs, LayerRunsSystemsInOrder)
+{
+	Core::EcsLayer layer;
+	std::string order;
+	layer.AddSystem("a", [&](Core::Registry&, float) { order += 'a'; });
+	layer.AddSystem("b", [&](Core::Registry&, float) { order += 'b'; });
+	layer.AddRenderSystem("r", [&](Core::Registry&, float) { order += 'r'; });
+	CHECK_THROWS(layer.AddSystem("a", [](Core::Registry&, float) {}), std::invalid_argument);
+
+	layer.OnUpdate();
+	layer.OnRender();
+	CHECK_EQ(order, std::string("abr"));
+}
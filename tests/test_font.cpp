@@ -0,0 +1,86 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	const unsigned char FakeTtf[4] = { 0, 1, 0, 0 };	// the headless rasterizer ignores the data
+}
+
+TEST(Font, GlyphsAreRasterizedOnce)
+{
+	rlx::DynamicFont font(FakeTtf, sizeof(FakeTtf), 16, 128);
+	font.Prepare("hello");
+	const uint64_t misses = font.GetStats().misses;
+	CHECK(misses >= 4);	// h, e, l, o
+
+	font.NextFrame();
+	const Font& f = font.Prepare("hole");
+	CHECK_EQ(font.GetStats().misses, misses);
+	CHECK(font.GetStats().hits > 0);
+	CHECK(f.glyphCount >= 4);
+}
+
+TEST(Font, MeasureUsesResidentGlyphs)
+{
+	rlx::DynamicFont font(FakeTtf, sizeof(FakeTtf), 20, 128);
+	Vector2 size = font.Measure("abc", 20.0f, 0.0f);
+	CHECK(size.x > 0.0f);
+	CHECK_EQ(size.y, 20.0f);
+}
+
+TEST(Font, AtlasGrowsThenEvicts)
+{
+	rlx::DynamicFont font(FakeTtf, sizeof(FakeTtf), 32, 64, 128);
+	for (int frame = 0; frame < 8; ++frame) {
+		std::vector<int> codepoints;
+		for (int i = 0; i < 40; ++i)
+			codepoints.push_back(0x4E00 + frame * 40 + i);
+		font.Prepare(codepoints.data(), static_cast<int>(codepoints.size()));
+		font.NextFrame();
+	}
+	const rlx::DynamicFontStats& stats = font.GetStats();
+	CHECK(stats.atlasGrowths > 0);
+	CHECK(stats.evictions > 0);
+	CHECK(font.GetAtlas().width <= 128);
+	CHECK(font.GetAtlas().height <= 128);
+}
+
+TEST(Font, FullAtlasHoldingOnlyFallbackDropsGlyphs)
+{
+	// One 17x32 cell fits in a 32x32 atlas: the pinned '?' takes it and nothing can ever be evicted
+	rlx::DynamicFont font(FakeTtf, sizeof(FakeTtf), 30, 32, 32);
+	font.Prepare("a");
+	CHECK_EQ(font.GetStats().dropped, uint64_t(1));
+
+	font.NextFrame();
+	font.Prepare("b");
+	const rlx::DynamicFontStats& stats = font.GetStats();
+	CHECK_EQ(stats.dropped, uint64_t(2));
+	CHECK_EQ(stats.evictions, uint64_t(0));
+	CHECK_EQ(font.GetFont().glyphCount, 1);	// just the fallback
+}
+
+TEST(Font, UnreadableDataAndFailedBatches)
+{
+	const unsigned char notAFont[4] = { 'G', 'I', 'F', '8' };
+	CHECK_THROWS(rlx::DynamicFont(notAFont, sizeof(notAFont), 16), std::runtime_error);
+
+	// Every codepoint batched with the failing one is lost; none of them may take atlas space
+	rlx::DynamicFont font(FakeTtf, sizeof(FakeTtf), 16, 64);
+	font.Prepare("?");
+	HeadlessFailFontCodepoint('x');
+	for (int frame = 0; frame < 4; ++frame) {
+		font.Prepare("xyz");
+		font.NextFrame();
+	}
+	HeadlessFailFontCodepoint(-1);
+	const rlx::DynamicFontStats& stats = font.GetStats();
+	CHECK_EQ(stats.failed, uint64_t(3));	// attempted once, not every frame
+	CHECK_EQ(stats.misses, uint64_t(3));
+	CHECK_EQ(font.GetFont().glyphCount, 1);
+	for (int i = 0; i < font.GetFont().glyphCount; ++i)
+		CHECK(font.GetFont().glyphs[i].value != 0);
+
+	font.Prepare("ab");
+	CHECK_EQ(font.GetFont().glyphCount, 3);
+}
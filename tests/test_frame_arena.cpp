@@ -0,0 +1,56 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+TEST(FrameArena, AllocatesAlignedFromBuffer)
+{
+	rlx::FrameArena arena(1024);
+	void* a = arena.allocate(3, 1);
+	void* b = arena.allocate(16, 16);
+	CHECK(a != nullptr);
+	CHECK_EQ(reinterpret_cast<uintptr_t>(b) % 16, uintptr_t(0));
+	CHECK_EQ(arena.GetStats().frameFallbacks, size_t(0));
+	CHECK_EQ(arena.GetStats().frameBytes, size_t(19));
+}
+
+TEST(FrameArena, PreviousFrameStaysValid)
+{
+	rlx::FrameArena arena(1024);
+	arena.NextFrame();
+	int* previous = static_cast<int*>(arena.allocate(64 * sizeof(int), alignof(int)));
+	for (int i = 0; i < 64; ++i) previous[i] = i;
+
+	arena.NextFrame();
+	int* current = static_cast<int*>(arena.allocate(64 * sizeof(int), alignof(int)));
+	for (int i = 0; i < 64; ++i) current[i] = -1;
+
+	bool intact = true;
+	for (int i = 0; i < 64; ++i) intact &= previous[i] == i;
+	CHECK(intact);
+}
+
+TEST(FrameArena, OverflowFallsBackThenGrows)
+{
+	rlx::FrameArena arena(128);
+	for (int frame = 0; frame < 4; ++frame) {
+		arena.NextFrame();
+		std::pmr::vector<double> v(&arena);
+		v.resize(1000);
+		if (frame < 2) CHECK(arena.GetStats().frameFallbacks > 0);
+		else CHECK_EQ(arena.GetStats().frameFallbacks, size_t(0));
+	}
+	CHECK(arena.GetCapacity() >= 1000 * sizeof(double));
+	CHECK(arena.GetStats().totalFallbacks > 0);
+	CHECK(arena.GetStats().highWaterBytes >= 1000 * sizeof(double));
+}
+
+TEST(FrameArena, ReserveAppliesAtReset)
+{
+	rlx::FrameArena arena(64);
+	arena.Reserve(1 << 16);
+	CHECK_EQ(arena.GetCapacity(), size_t(64));
+	arena.NextFrame();
+	CHECK(arena.GetCapacity() >= size_t(1 << 16));
+	CHECK(arena.is_equal(arena));
+	rlx::FrameArena other(64);
+	CHECK(!arena.is_equal(other));
+}
@@ -0,0 +1,183 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	// Scripted time: sleeps return jitter seconds late, spinning advances in small steps
+	class MockClock : public rlx::FrameClock {
+	public:
+		double Now() override { return time; }
+		void Sleep(double seconds) override {
+			time += seconds + jitter;
+			++sleeps;
+		}
+		void Relax() override { time += 0.00001; }
+
+		double time = 100.0;
+		double jitter = 0.0;
+		int sleeps = 0;
+	};
+
+	void Frames(rlx::FramePacer& pacer, MockClock& clock, int frames, double work) {
+		for (int i = 0; i < frames; ++i) {
+			pacer.BeginFrame();
+			clock.time += work;
+			pacer.EndFrame();
+		}
+	}
+}
+
+TEST(FramePacer, HybridHoldsTargetDespiteSleepJitter)
+{
+	MockClock clock;
+	clock.jitter = 0.002;
+	rlx::FramePacer pacer(&clock);
+	pacer.SetMode(rlx::FramePacer::Mode::Hybrid);
+	pacer.SetTargetFPS(100.0);
+
+	Frames(pacer, clock, 5, 0.003);	// learns the 2 ms overshoot, missing at most the first deadline
+	CHECK(pacer.GetStats().missedDeadlines <= 1);
+	CHECK_NEAR(pacer.GetStats().sleepOvershoot, 0.002, 1e-9);
+
+	pacer.ResetStats();
+	Frames(pacer, clock, 100, 0.003);
+	const rlx::FramePacerStats& stats = pacer.GetStats();
+	CHECK_EQ(stats.frames, uint64_t(100));
+	CHECK_EQ(stats.missedDeadlines, uint64_t(0));
+	CHECK_NEAR(stats.meanFrameTime, 0.01, 2e-5);
+	CHECK(stats.FrameTimeStdDev() < 5e-5);
+	CHECK(stats.spinTime > 0.0);
+	CHECK_NEAR(pacer.GetFrameTime(), 0.01f, 1e-4f);
+}
+
+TEST(FramePacer, SlowFramesCountAsMissedWithoutCatchUpBursts)
+{
+	MockClock clock;
+	rlx::FramePacer pacer(&clock);
+	pacer.SetMode(rlx::FramePacer::Mode::Hybrid);
+	pacer.SetTargetFPS(100.0);
+
+	// 15 ms of work runs at its own pace; every other present lines up with the old phase again
+	Frames(pacer, clock, 20, 0.015);
+	CHECK(pacer.GetStats().missedDeadlines >= 10);
+	CHECK_NEAR(pacer.GetStats().meanFrameTime, 0.015, 5e-5);
+	CHECK(pacer.GetStats().minFrameTime >= 0.015 - 1e-9);
+
+	// Back under budget: no frames shorter than the target to make up the lost time
+	pacer.ResetStats();
+	Frames(pacer, clock, 20, 0.004);
+	CHECK_NEAR(pacer.GetStats().minFrameTime, 0.01, 2e-5);
+	CHECK(pacer.GetStats().missedDeadlines <= 1);
+}
+
+TEST(FramePacer, JustInTimeSamplesInputBeforeDeadline)
+{
+	MockClock clock;
+	clock.jitter = 0.001;
+	rlx::FramePacer pacer(&clock);
+	pacer.SetTargetFPS(60.0);
+
+	pacer.SetMode(rlx::FramePacer::Mode::Hybrid);
+	Frames(pacer, clock, 10, 0.002);
+	const double hybridLatency = pacer.GetStats().lastInputLatency;
+	CHECK(hybridLatency > 0.016);
+
+	pacer.SetMode(rlx::FramePacer::Mode::JustInTime);
+	pacer.ResetStats();
+	Frames(pacer, clock, 30, 0.002);
+	const rlx::FramePacerStats& stats = pacer.GetStats();
+	CHECK_EQ(stats.missedDeadlines, uint64_t(0));
+	CHECK_NEAR(stats.workEstimate, 0.002, 1e-9);
+	CHECK(stats.lastInputLatency < 0.002 + pacer.GetJustInTimeHeadroom() + 0.0005);
+	CHECK_NEAR(stats.meanFrameTime, 1.0 / 60.0, 2e-5);
+}
+
+TEST(FramePacer, OffAndZeroTargetNeverWait)
+{
+	MockClock clock;
+	rlx::FramePacer pacer(&clock);
+	pacer.SetTargetFPS(60.0);
+	Frames(pacer, clock, 10, 0.001);
+	CHECK_EQ(clock.sleeps, 0);
+	CHECK_NEAR(pacer.GetStats().meanFrameTime, 0.001, 1e-9);
+	CHECK_EQ(pacer.GetStats().missedDeadlines, uint64_t(0));
+
+	pacer.SetMode(rlx::FramePacer::Mode::Hybrid);
+	pacer.SetTargetFPS(0.0);
+	Frames(pacer, clock, 10, 0.001);
+	CHECK_EQ(clock.sleeps, 0);
+	CHECK_EQ(pacer.GetStats().spinTime, 0.0);
+}
+
+TEST(FramePacer, CalibrateMeasuresSleepOvershoot)
+{
+	MockClock clock;
+	clock.jitter = 0.003;
+	rlx::FramePacer pacer(&clock);
+	pacer.Calibrate(5);
+	CHECK_EQ(clock.sleeps, 5);
+	CHECK_NEAR(pacer.GetStats().sleepOvershoot, 0.003, 1e-9);
+
+	clock.jitter = 0.0005;	// better timer: the estimate decays rather than dropping at once
+	pacer.Calibrate(1);
+	CHECK(pacer.GetStats().sleepOvershoot > 0.0025);
+	pacer.Calibrate(200);
+	CHECK_NEAR(pacer.GetStats().sleepOvershoot, 0.0005, 1e-5);
+}
+
+TEST(FramePacer, ApplicationRunWaitsBeforeInputPoll)
+{
+	// Marks every wait the pacer itself makes; the stub logs swaps, its limiter waits and polls
+	class MarkingClock : public rlx::FrameClock {
+	public:
+		double Now() override { return rlx::SystemFrameClock::Instance().Now(); }
+		void Sleep(double seconds) override { HeadlessMark('w'); rlx::SystemFrameClock::Instance().Sleep(seconds); }
+		void Relax() override { HeadlessMark('w'); }
+	};
+	class MarkingLayer : public Core::Layer {
+	public:
+		MarkingLayer() { Identifier = "marking"; }
+		void OnUpdate() override { HeadlessMark('u'); }
+		void OnRender() override {}
+	};
+
+	MarkingClock clock;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<MarkingLayer>();
+	Core::Application::GetFramePacer().SetClock(&clock);
+	Core::Application::SetFramePacing(rlx::FramePacer::Mode::JustInTime, 200.0);
+	// Headless raylib polls input inside EndDrawing, so pacing is left to its limiter
+	CHECK(Core::Application::GetFramePacer().GetMode() == rlx::FramePacer::Mode::Off);
+
+	Core::Application::GetFramePacer().ResetStats();
+	HeadlessResetCounters();
+	const auto start = std::chrono::steady_clock::now();
+	HeadlessSetFrameLimit(10);
+	Core::Application::Run();
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	const rlx::FramePacerStats& stats = Core::Application::GetFramePacerStats();
+	CHECK_EQ(stats.frames, uint64_t(10));
+	CHECK(elapsed > 9 * 0.005 * 0.9);
+	CHECK(stats.maxFrameTime >= 0.005 - 1e-4);
+
+	// Every wait is followed by a poll before the next update reads input
+	const std::string events = HeadlessGetEvents();
+	CHECK(events.find('w') != std::string::npos);
+	bool waitedSincePoll = false;
+	int updates = 0;
+	for (char e : events) {
+		if (e == 'w') waitedSincePoll = true;
+		if (e == 'p') waitedSincePoll = false;
+		if (e == 'u') {
+			++updates;
+			CHECK(!waitedSincePoll);
+		}
+	}
+	CHECK_EQ(updates, 10);
+
+	Core::Application::Remove<MarkingLayer>();
+	Core::Application::SetFramePacing(rlx::FramePacer::Mode::Off);
+	Core::Application::GetFramePacer().SetClock(nullptr);
+	Core::Application::SetTargetFPS(0);
+}
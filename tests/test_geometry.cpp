@@ -0,0 +1,108 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+using rlx::Rectangle;
+
+TEST(Geometry, ContainsAndIntersects)
+{
+	Rectangle<int> r{ 10, 10, 20, 20 };
+	CHECK(r.contains(10, 10));
+	CHECK(!r.contains(30, 10));
+	CHECK(r.intersects(Rectangle<int>{ 25, 25, 10, 10 }));
+	CHECK(!r.intersects(Rectangle<int>{ 30, 10, 5, 5 }));
+	CHECK(r.intersects(Rectangle<float>{ 29.5f, 29.5f, 1.0f, 1.0f }));
+	CHECK_EQ(r.right(), 30);
+	CHECK_EQ(r.bottom(), 30);
+}
+
+TEST(Geometry, PaddingAndMargin)
+{
+	rlx::Box<float> box(0, 0, 100, 50, { 5, 5, 5, 5 }, { 2, 2, 2, 2 });
+	CHECK(box.with_padding() == Rectangle<float>(5, 5, 90, 40));
+	CHECK(box.with_margin() == Rectangle<float>(-2, -2, 104, 54));
+	CHECK(box.without_padding() == box.rect);
+}
+
+TEST(Geometry, RaylibConversion)
+{
+	Rectangle<int> r{ 1, 2, 3, 4 };
+	rlRectangle raw = r;
+	CHECK_EQ(raw.width, 3.0f);
+	Rectangle<int> back(rlRectangle{ 1.9f, 2.0f, 3.0f, 4.0f });
+	CHECK_EQ(back.x, 1);
+	Rectangle<float> widened = r;
+	CHECK_EQ(widened.height, 4.0f);
+}
+
+TEST(Geometry, LayoutRowGrowAndGap)
+{
+	rlx::Layout<float> layout({ .direction = rlx::FlexDirection::Row, .gap = 10.0f, .padding = { 5, 5, 5, 5 } });
+	auto a = layout.AddNode(rlx::Layout<float>::Root, { .width = 100.0f });
+	auto b = layout.AddNode(rlx::Layout<float>::Root, { .grow = 1.0f });
+	layout.Compute({ 0, 0, 400, 100 });
+
+	CHECK_NEAR(layout.GetRect(a).x, 5.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(a).width, 100.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(b).x, 115.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(b).width, 280.0f, 1e-4);
+	CHECK(!layout.IsDirty(b));
+
+	layout.EditStyle(a).width = 50.0f;
+	CHECK(layout.IsDirty(rlx::Layout<float>::Root));
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(b).width, 330.0f, 1e-4);
+}
+
+TEST(Geometry, LayoutTextMeasuresWithFont)
+{
+	rlx::Layout<float> layout;
+	auto text = layout.AddText(rlx::Layout<float>::Root, "abcd", 20.0f);
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK(layout.IsText(text));
+	CHECK_NEAR(layout.GetRect(text).width, 40.0f, 1e-4);	// headless font: half the size per character
+}
+
+TEST(Geometry, LayoutFixedSizeRootMeasuresChildren)
+{
+	rlx::Layout<float> layout({ .direction = rlx::FlexDirection::Row, .width = 400.0f, .height = 100.0f });
+	auto text = layout.AddText(rlx::Layout<float>::Root, "abcd", 20.0f);
+	auto fixed = layout.AddNode(rlx::Layout<float>::Root, { .width = 50.0f });
+	layout.Compute({ 0, 0, 400, 100 });
+
+	CHECK_NEAR(layout.GetRect(text).width, 40.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(fixed).x, 40.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(fixed).width, 50.0f, 1e-4);
+
+	layout.SetText(text, "abcdef");
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(text).width, 60.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(fixed).x, 60.0f, 1e-4);
+}
+
+TEST(Geometry, LayoutUnhiddenNodeIsLaidOutAgain)
+{
+	rlx::Layout<float> layout({ .direction = rlx::FlexDirection::Row });
+	auto a = layout.AddNode(rlx::Layout<float>::Root, { .width = 100.0f, .hidden = true });
+	auto b = layout.AddNode(rlx::Layout<float>::Root, { .width = 30.0f });
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(b).x, 0.0f, 1e-4);
+	CHECK(!layout.IsDirty(rlx::Layout<float>::Root));
+
+	layout.EditStyle(a).hidden = false;
+	CHECK(layout.IsDirty(rlx::Layout<float>::Root));
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(a).width, 100.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(b).x, 100.0f, 1e-4);
+
+	layout.EditStyle(a).hidden = true;
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(b).x, 0.0f, 1e-4);
+
+	// Edited while hidden, then shown again
+	layout.EditStyle(a).width = 70.0f;
+	layout.Compute({ 0, 0, 400, 100 });
+	layout.EditStyle(a).hidden = false;
+	layout.Compute({ 0, 0, 400, 100 });
+	CHECK_NEAR(layout.GetRect(a).width, 70.0f, 1e-4);
+	CHECK_NEAR(layout.GetRect(b).x, 70.0f, 1e-4);
+}
@@ -0,0 +1,232 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	Color PixelAt(const Image& image, int x, int y) {
+		Color c;
+		std::memcpy(&c, static_cast<const unsigned char*>(image.data) + (static_cast<size_t>(y) * image.width + x) * 4, 4);
+		return c;
+	}
+
+	// Pipelines only write through mutable views
+	template<typename View>
+	concept CanApply = requires(const rlx::ImagePipeline& pipeline, const View& view) { pipeline.Apply(view); };
+
+	// Each pixel encodes its own coordinates, so any copy can be checked against its source position
+	rlx::Managed<Image> CoordinateImage(int width, int height) {
+		rlx::Managed<Image> image(GenImageColor(width, height, BLANK));
+		unsigned char* px = static_cast<unsigned char*>(image->data);
+		for (int y = 0; y < height; ++y)
+			for (int x = 0; x < width; ++x) {
+				unsigned char* p = px + (static_cast<size_t>(y) * width + x) * 4;
+				p[0] = static_cast<unsigned char>(x);
+				p[1] = static_cast<unsigned char>(y);
+				p[2] = 7;
+				p[3] = 255;
+			}
+		return image;
+	}
+}
+
+TEST(Image, FusedPointOpsMatchSequential)
+{
+	rlx::Managed<Image> image(GenImageColor(33, 17, Color{ 200, 100, 50, 255 }));
+	rlx::ImagePipeline pipeline;
+	pipeline.Invert().Brightness(10);
+	CHECK_EQ(pipeline.GetPassCount(), size_t(1));	// fused into one pass
+	pipeline.Apply(image);
+
+	Color c = PixelAt(image, 32, 16);
+	CHECK_NEAR(c.r, 65, 1);
+	CHECK_NEAR(c.g, 165, 1);
+	CHECK_NEAR(c.b, 215, 1);
+	CHECK_EQ(c.a, 255);
+}
+
+TEST(Image, ClampingStagesAreNotFused)
+{
+	rlx::Managed<Image> image = CoordinateImage(256, 4);
+	rlx::Managed<Image> expected(ImageCopy(*image));
+	ImageColorBrightness(&*expected, 200);
+	ImageColorBrightness(&*expected, -200);
+	ImageColorInvert(&*expected);
+	ImageColorBrightness(&*expected, 30);
+
+	rlx::ImagePipeline pipeline;
+	pipeline.Brightness(200).Brightness(-200).Invert().Brightness(30);
+	CHECK_EQ(pipeline.GetPassCount(), size_t(3));	// Brightness clamps, so only Invert fuses with what follows
+	pipeline.Apply(image);
+	CHECK(std::memcmp(image->data, expected->data, 256 * 4 * 4) == 0);
+	CHECK_EQ(PixelAt(image, 100, 0).r, 255 - 55 + 30);	// 100 + 200 clamps to 255 before the -200
+}
+
+TEST(Image, GrayscaleAndFormat)
+{
+	rlx::Managed<Image> image(GenImageColor(8, 8, Color{ 255, 0, 0, 255 }));
+	rlx::ImagePipeline().Grayscale().Format(PIXELFORMAT_UNCOMPRESSED_GRAYSCALE).Apply(image);
+	CHECK_EQ(image->format, (int)PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+	unsigned char v = static_cast<unsigned char*>(image->data)[0];
+	CHECK_NEAR(v, 76, 2);
+}
+
+TEST(Image, BlurKeepsUniformImageAndResizeChangesSize)
+{
+	rlx::Managed<Image> image(GenImageColor(100, 70, Color{ 10, 20, 30, 40 }));
+	rlx::ImagePipeline().Blur(3).Resize(50, 35).Apply(image);
+	CHECK_EQ(image->width, 50);
+	CHECK_EQ(image->height, 35);
+	Color c = PixelAt(image, 25, 17);
+	CHECK_EQ(c.r, 10);
+	CHECK_EQ(c.a, 40);
+}
+
+TEST(Image, MipmapsMustBeLast)
+{
+	rlx::Managed<Image> image(GenImageColor(64, 32, WHITE));
+	rlx::ImagePipeline pipeline;
+	pipeline.Mipmaps();
+	CHECK_THROWS(pipeline.Blur(1), std::logic_error);
+	pipeline.Apply(image);
+	CHECK_EQ(image->mipmaps, 7);
+}
+
+TEST(Image, ViewsShareSourcePixels)
+{
+	rlx::Managed<Image> image = CoordinateImage(64, 32);
+	rlx::ImageView whole(image);
+	CHECK(whole.IsContiguous());
+	CHECK_EQ(whole.GetStride(), size_t(64 * 4));
+
+	rlx::ImageView sub = whole.Sub({ 10, 4, 20, 8 });
+	CHECK(!sub.IsContiguous());
+	CHECK(sub.Data() == static_cast<uint8_t*>(image->data) + (4 * 64 + 10) * 4);
+	rlx::ImageView inner = sub.Sub({ 2, 3, 5, 5 });
+	CHECK_EQ(inner.GetRegion().x, 12);
+	CHECK_EQ(inner.GetRegion().y, 7);
+	CHECK_EQ(inner.Pixel(0, 0)[0], 12);
+	CHECK_EQ(inner.Pixel(4, 4)[1], 11);
+
+	inner.Pixel(0, 0)[2] = 99;	// writes land in the source image
+	CHECK_EQ(PixelAt(image, 12, 7).b, 99);
+
+	CHECK_THROWS(whole.Sub({ 60, 0, 8, 8 }), std::out_of_range);
+	CHECK_THROWS(sub.Sub({ -1, 0, 2, 2 }), std::out_of_range);
+	rlx::Managed<Image> empty;
+	CHECK_THROWS(rlx::ImageView{ empty }, std::invalid_argument);
+}
+
+TEST(Image, SliceSpriteSheetWithoutCopies)
+{
+	rlx::Managed<Image> sheet = CoordinateImage(2 + 4 * 10 + 3 * 2 + 2 + 1, 2 + 3 * 8 + 2 * 2 + 2);	// margin on every side, one spare column
+	std::vector<rlx::ImageView> cells = rlx::ImageView(sheet).Slice(10, 8, 2, 2);
+	REQUIRE(cells.size() == 12);
+	CHECK_EQ(cells[5].GetRegion().x, 2 + 1 * 12);
+	CHECK_EQ(cells[5].GetRegion().y, 2 + 1 * 10);
+	CHECK_EQ(cells[5].Pixel(0, 0)[0], 14);
+	CHECK_EQ(cells[11].Pixel(9, 7)[1], 2 + 2 * 10 + 7);
+
+	rlx::Managed<Image> copy = cells[5].ToImage();
+	CHECK_EQ(copy->width, 10);
+	CHECK_EQ(copy->height, 8);
+	CHECK_EQ(PixelAt(copy, 3, 2).r, 14 + 3);
+	CHECK_EQ(PixelAt(copy, 3, 2).g, 12 + 2);
+}
+
+TEST(Image, UploadPacksStridedViews)
+{
+	rlx::Managed<Image> image = CoordinateImage(32, 32);
+	rlx::Managed<Texture2D> texture(*image);
+	std::vector<uint8_t> scratch;
+
+	rlx::ImageView cell = rlx::ImageView(image).Sub({ 8, 16, 4, 2 });
+	rlx::UpdateTextureRegion(texture, 1, 1, cell, &scratch);
+	int size = 0;
+	const unsigned char* uploaded = HeadlessGetLastUpload(&size);
+	REQUIRE(size == 4 * 2 * 4);
+	CHECK_EQ(uploaded[0], 8);
+	CHECK_EQ(uploaded[1], 16);
+	CHECK_EQ(uploaded[4 * 4 + 0], 8);
+	CHECK_EQ(uploaded[4 * 4 + 1], 17);
+	CHECK_EQ(scratch.size(), size_t(size));
+
+	rlx::ImageView rows = rlx::ImageView(image).Sub({ 0, 5, 32, 3 });
+	rlx::UpdateTextureRegion(texture, 0, 0, rows);
+	uploaded = HeadlessGetLastUpload(&size);
+	CHECK(rows.IsContiguous());
+	CHECK_EQ(uploaded[1], 5);
+
+	CHECK_THROWS(rlx::UpdateTextureRegion(texture, 30, 0, cell), std::out_of_range);
+	rlx::Managed<Texture2D> fromView = rlx::LoadTextureFromView(cell);
+	CHECK_EQ(fromView->width, 4);
+}
+
+TEST(Image, PipelineRunsOnViewRegionOnly)
+{
+	rlx::Managed<Image> image(GenImageColor(40, 40, Color{ 200, 100, 50, 255 }));
+	rlx::ImageView region = rlx::ImageView(image).Sub({ 10, 10, 20, 20 });
+	rlx::ImagePipeline().Invert().Blur(2).Apply(region);
+
+	CHECK_EQ(PixelAt(image, 15, 15).r, 55);
+	CHECK_EQ(PixelAt(image, 29, 29).g, 155);
+	CHECK_EQ(PixelAt(image, 9, 15).r, 200);
+	CHECK_EQ(PixelAt(image, 30, 30).r, 200);
+	CHECK_THROWS(rlx::ImagePipeline().Resize(4, 4).Apply(region), std::logic_error);
+}
+
+TEST(Image, SharedImageCopiesOnWrite)
+{
+	rlx::Managed<Image> source = CoordinateImage(16, 16);
+	void* pixels = source->data;
+	rlx::SharedImage a(std::move(source));
+	CHECK(a.Get().data == pixels);	// adopted, not copied
+
+	rlx::SharedImage b = a;
+	CHECK(b.IsShared());
+	CHECK(b.View().Data() == a.View().Data());
+
+	b.MutableView({ 0, 0, 1, 1 }).Pixel(0, 0)[0] = 42;
+	CHECK(!a.IsShared());
+	CHECK(b.Get().data != pixels);
+	CHECK_EQ(PixelAt(a.Get(), 0, 0).r, 0);
+	CHECK_EQ(PixelAt(b.Get(), 0, 0).r, 42);
+
+	a.Mutable();	// sole owner, no copy
+	CHECK(a.Get().data == pixels);
+	rlx::Managed<Image> released = a.Release();
+	CHECK(released->data == pixels);
+	CHECK(!a.IsLoaded());
+
+	rlx::SharedImage cell(rlx::ImageView(released).Sub({ 4, 4, 2, 2 }));
+	CHECK_EQ(cell.GetWidth(), 2);
+	CHECK_EQ(PixelAt(cell.Get(), 1, 1).g, 5);
+}
+
+TEST(Image, ConstSourcesGiveReadOnlyViews)
+{
+	static_assert(std::is_same_v<decltype(std::declval<rlx::ConstImageView>().Data()), const uint8_t*>);
+	static_assert(!std::is_constructible_v<rlx::ImageView, const Image&>);
+	static_assert(!std::is_constructible_v<rlx::ImageView, const rlx::Managed<Image>&>);
+	static_assert(!std::is_constructible_v<rlx::ImageView, rlx::ConstImageView>);
+	static_assert(std::is_convertible_v<rlx::ImageView, rlx::ConstImageView>);
+	static_assert(!CanApply<rlx::ConstImageView>);
+	static_assert(CanApply<rlx::ImageView>);
+
+	rlx::SharedImage a(CoordinateImage(16, 16));
+	rlx::SharedImage b = a;
+	rlx::ConstImageView before = a.View({ 2, 2, 4, 4 });
+	CHECK(before.Data() == b.View({ 2, 2, 4, 4 }).Data());
+
+	// Writing through b detaches it; a and the view taken from it keep the original pixels
+	rlx::ImagePipeline().Invert().Apply(b.MutableView({ 2, 2, 4, 4 }));
+	CHECK(!a.IsShared());
+	CHECK(a.Get().data != b.Get().data);
+	CHECK_EQ(before.Pixel(0, 0)[0], 2);
+	CHECK_EQ(PixelAt(a.Get(), 2, 2).r, 2);
+	CHECK_EQ(PixelAt(b.Get(), 2, 2).r, 255 - 2);
+	CHECK_EQ(PixelAt(b.Get(), 1, 1).r, 1);
+
+	rlx::Managed<Image> target(GenImageColor(4, 4, BLACK));
+	rlx::ImageView(target).CopyFrom(a.View({ 2, 2, 4, 4 }));
+	CHECK_EQ(PixelAt(target, 0, 0).g, 2);
+}
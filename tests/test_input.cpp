@@ -0,0 +1,249 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	// Moves a point with the arrow keys and the frame time, and scripts the next frame's headless input
+	// while recording so the workload is not constant
+	struct Mover {
+		Vector2 position{ 0.0f, 0.0f };
+		int jumps = 0;
+		float clicks = 0.0f;
+		std::string typed;
+		int updates = 0;
+	};
+
+	class MoverLayer : public Core::Layer {
+	public:
+		MoverLayer(Mover& state, bool script) : m_state(state), m_script(script) { Identifier = "mover"; }
+
+		void OnUpdate() override {
+			Mover& s = m_state;
+			const float speed = 100.0f * rlx::Input::GetFrameTime();
+			if (rlx::Input::IsKeyDown(KEY_RIGHT)) s.position.x += speed;
+			if (rlx::Input::IsKeyDown(KEY_DOWN)) s.position.y += speed;
+			if (rlx::Input::IsKeyPressed(KEY_SPACE)) ++s.jumps;
+			if (rlx::Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) s.clicks += rlx::Input::GetMousePosition().x;
+			for (int c = rlx::Input::GetCharPressed(); c != 0; c = rlx::Input::GetCharPressed())
+				s.typed.push_back(static_cast<char>(c));
+			const int updates = ++s.updates;
+
+			if (m_script) {
+				HeadlessSetKeyDown(KEY_RIGHT, updates % 3 != 0);
+				HeadlessSetKeyDown(KEY_DOWN, updates > 5);
+				HeadlessSetKeyDown(KEY_SPACE, updates % 4 == 1);
+				HeadlessSetMouseButtonDown(MOUSE_BUTTON_LEFT, updates == 2);
+				HeadlessSetMousePosition(static_cast<float>(updates * 10), 5.0f);
+				if (updates == 3) { HeadlessPushChar('h'); HeadlessPushChar('i'); }
+				HeadlessSetFrameTime(updates % 2 ? 1.0f / 60.0f : 1.0f / 30.0f);
+			}
+		}
+		void OnRender() override {}
+
+	private:
+		Mover& m_state;
+		bool m_script;
+	};
+
+	void ReleaseAll() {
+		HeadlessSetKeyDown(KEY_RIGHT, false);
+		HeadlessSetKeyDown(KEY_DOWN, false);
+		HeadlessSetKeyDown(KEY_SPACE, false);
+		HeadlessSetMouseButtonDown(MOUSE_BUTTON_LEFT, false);
+		HeadlessSetFrameTime(1.0f / 60.0f);
+		PollInputEvents();
+		PollInputEvents();
+	}
+}
+
+TEST(Input, LiveFrameDerivesEdges)
+{
+	ReleaseAll();
+	rlx::Input::BeginFrame();
+
+	HeadlessSetKeyDown(KEY_A, true);
+	HeadlessSetMousePosition(10.0f, 20.0f);
+	HeadlessPushChar('x');
+	PollInputEvents();
+	rlx::Input::BeginFrame();
+	CHECK(rlx::Input::IsKeyPressed(KEY_A));
+	CHECK(rlx::Input::IsKeyDown(KEY_A));
+	CHECK(!rlx::Input::IsKeyReleased(KEY_A));
+	CHECK_EQ(rlx::Input::GetCharPressed(), int('x'));
+	CHECK_EQ(rlx::Input::GetCharPressed(), 0);
+	CHECK_NEAR(rlx::Input::GetMousePosition().y, 20.0f, 0.0f);
+
+	PollInputEvents();
+	rlx::Input::BeginFrame();
+	CHECK(!rlx::Input::IsKeyPressed(KEY_A));
+	CHECK(rlx::Input::IsKeyDown(KEY_A));
+
+	HeadlessSetKeyDown(KEY_A, false);
+	HeadlessSetMousePosition(15.0f, 18.0f);
+	PollInputEvents();
+	rlx::Input::BeginFrame();
+	CHECK(rlx::Input::IsKeyReleased(KEY_A));
+	CHECK(rlx::Input::IsKeyUp(KEY_A));
+	CHECK_NEAR(rlx::Input::GetMouseDelta().x, 5.0f, 0.0f);
+	CHECK_NEAR(rlx::Input::GetMouseDelta().y, -2.0f, 0.0f);
+	CHECK(!rlx::Input::IsKeyDown(-1));
+	CHECK(!rlx::Input::IsKeyDown(rlx::InputFrame::KeyCount));
+}
+
+TEST(Input, LiveRunLeavesRaylibCharQueue)
+{
+	// A layer that predates rlx::Input and reads typed text from raylib
+	class TypingLayer : public Core::Layer {
+	public:
+		explicit TypingLayer(std::string& typed) : m_typed(typed) { Identifier = "typing"; }
+		void OnUpdate() override {
+			for (int c = ::GetCharPressed(); c != 0; c = ::GetCharPressed())
+				m_typed.push_back(static_cast<char>(c));
+			if (++m_updates == 2) { HeadlessPushChar('a'); HeadlessPushChar('b'); }
+			if (m_updates == 4) { HeadlessPushChar('c'); HeadlessPushChar('d'); }
+		}
+		void OnRender() override {}
+
+	private:
+		std::string& m_typed;
+		int m_updates = 0;
+	};
+
+	ReleaseAll();
+	std::string typed;
+	Core::Application::InitializeComponents();
+	Core::Application::Add<TypingLayer>(typed);
+	HeadlessSetFrameLimit(5);
+	Core::Application::Run();
+	Core::Application::Remove<TypingLayer>();
+	CHECK_EQ(typed, std::string("abcd"));
+}
+
+TEST(Input, LogRoundTripIsDeltaEncoded)
+{
+	rlx::InputLog log;
+	rlx::InputFrame frame;
+	frame.dt = 1.0f / 60.0f;
+	for (int i = 0; i < 100; ++i)
+		log.Append(frame);
+	frame.keys.set(KEY_W);
+	frame.keys.set(KEY_LEFT_SHIFT);
+	frame.buttons = 0b101;
+	frame.mouse = { 12.5f, -3.0f };
+	frame.wheel = { 0.0f, 1.0f };
+	frame.chars[0] = 0x263A;
+	frame.charCount = 1;
+	frame.dt = 1.0f / 30.0f;
+	log.Append(frame);
+	frame.wheel = { 0.0f, 0.0f };
+	frame.charCount = 0;
+	log.Append(frame);
+
+	const std::vector<uint8_t> bytes = log.Encode();
+	// 12 byte header, one byte per idle frame, the first frame also carries its dt
+	CHECK(bytes.size() < 12 + 100 + 4 + 64);
+
+	rlx::InputLog decoded = rlx::InputLog::Decode(bytes.data(), bytes.size());
+	REQUIRE(decoded.size() == log.size());
+	for (size_t i = 0; i < log.size(); ++i)
+		CHECK(decoded[i] == log[i]);
+	CHECK_NEAR(decoded.GetDuration(), log.GetDuration(), 1e-9);
+
+	auto path = std::filesystem::temp_directory_path() / "rlx_input_test.rlxi";
+	log.Save(path);
+	CHECK_EQ(rlx::InputLog::Load(path).size(), log.size());
+	std::filesystem::remove(path);
+}
+
+TEST(Input, DecodeRejectsCorruptLogs)
+{
+	rlx::InputLog log;
+	rlx::InputFrame frame;
+	frame.keys.set(KEY_Q);
+	log.Append(frame);
+	std::vector<uint8_t> bytes = log.Encode();
+
+	CHECK_THROWS(rlx::InputLog::Decode(bytes.data(), bytes.size() - 1), std::runtime_error);
+	CHECK_THROWS(rlx::InputLog::Decode(bytes.data(), 3), std::runtime_error);
+	bytes[0] = 'X';
+	CHECK_THROWS(rlx::InputLog::Decode(bytes.data(), bytes.size()), std::runtime_error);
+}
+
+TEST(Input, ReplayReproducesRecordedRun)
+{
+	ReleaseAll();
+	Core::Application::InitializeComponents();
+	Mover recorded;
+	Core::Application::Add<MoverLayer>(recorded, true);
+
+	rlx::Input::StartRecording(32);
+	HeadlessSetFrameLimit(20);
+	Core::Application::Run();
+	rlx::InputLog log = rlx::Input::StopRecording();
+	Core::Application::Remove<MoverLayer>();
+	ReleaseAll();
+
+	REQUIRE(log.size() == 20);
+	CHECK_EQ(recorded.updates, 20);
+	CHECK(recorded.jumps > 0);
+	CHECK_EQ(recorded.typed, std::string("hi"));
+
+	// Replay with live input and frame time set to something else entirely
+	Mover replayed;
+	Core::Application::Add<MoverLayer>(replayed, false);
+	HeadlessSetFrameTime(0.5f);
+	HeadlessSetKeyDown(KEY_DOWN, true);
+	auto path = std::filesystem::temp_directory_path() / "rlx_replay_timings.json";
+	rlx::ReplayOptions options;
+	options.timingsPath = path;
+	HeadlessSetFrameLimit(-1);
+	Core::Application::SetTargetFPS(240);
+	rlx::ReplayReport report = Core::Application::Replay(log, options);
+
+	CHECK_EQ(replayed.updates, 20);
+	CHECK_NEAR(replayed.position.x, recorded.position.x, 0.0f);
+	CHECK_NEAR(replayed.position.y, recorded.position.y, 0.0f);
+	CHECK_EQ(replayed.jumps, recorded.jumps);
+	CHECK_NEAR(replayed.clicks, recorded.clicks, 0.0f);
+	CHECK_EQ(replayed.typed, recorded.typed);
+	CHECK_EQ(report.frames.size(), size_t(20));
+	CHECK_EQ(HeadlessGetTargetFPS(), 240);	// the rendered replay ran uncapped, then restored the target
+	CHECK(rlx::Input::GetMode() == rlx::Input::Mode::Live);
+	CHECK(report.Summarize(&rlx::ReplayFrameTiming::updateNs).max >= report.Summarize(&rlx::ReplayFrameTiming::updateNs).p50);
+
+	std::ifstream file(path);
+	std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	CHECK(json.find("\"schema\": \"rlx-bench/1\"") != std::string::npos);
+	CHECK(json.find("\"name\": \"replay/update\", \"size\": 20") != std::string::npos);
+	CHECK(json.find("\"name\": \"replay/render_p95\"") != std::string::npos);
+	file.close();
+	std::filesystem::remove(path);
+	Core::Application::SetTargetFPS(0);
+
+	Core::Application::Remove<MoverLayer>();
+	ReleaseAll();
+}
+
+TEST(Input, UpdateOnlyReplaySkipsRendering)
+{
+	rlx::InputLog log;
+	rlx::InputFrame frame;
+	frame.dt = 0.25f;
+	frame.keys.set(KEY_RIGHT);
+	for (int i = 0; i < 8; ++i)
+		log.Append(frame);
+
+	Mover layer;
+	Core::Application::Add<MoverLayer>(layer, false);
+	HeadlessResetCounters();
+	const long long frames = HeadlessGetFrameCount();
+	rlx::ReplayOptions options;
+	options.render = false;
+	rlx::ReplayReport report = Core::Application::Replay(log, options);
+
+	CHECK_EQ(layer.updates, 8);
+	CHECK_NEAR(layer.position.x, 8 * 25.0f, 1e-4f);
+	CHECK_EQ(HeadlessGetFrameCount(), frames);
+	CHECK_EQ(report.frames[3].renderNs, uint64_t(0));
+	Core::Application::Remove<MoverLayer>();
+}
@@ -0,0 +1,69 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+TEST(OrderedMap, PreservesInsertionOrder)
+{
+	ordered_map<std::string, int> map;
+	map["zeta"] = 1;
+	map["alpha"] = 2;
+	map["mid"] = 3;
+
+	std::vector<std::string> keys;
+	for (const auto& [key, _] : map)
+		keys.push_back(key);
+	CHECK_EQ(keys.size(), size_t(3));
+	CHECK_EQ(keys[0], std::string("zeta"));
+	CHECK_EQ(keys[1], std::string("alpha"));
+	CHECK_EQ(keys[2], std::string("mid"));
+}
+
+TEST(OrderedMap, DuplicateInsertKeepsFirst)
+{
+	ordered_map<int, int> map;
+	auto [it, inserted] = map.emplace(7, 1);
+	CHECK(inserted);
+	auto [again, insertedAgain] = map.emplace(7, 2);
+	CHECK(!insertedAgain);
+	CHECK_EQ(again->second, 1);
+	map.push_back(7, 3);
+	CHECK_EQ(map.at(7), 1);
+	CHECK_EQ(map.size(), size_t(1));
+}
+
+TEST(OrderedMap, EraseReindexes)
+{
+	ordered_map<int, std::string> map;
+	for (int i = 0; i < 5; ++i)
+		map.push_back(i, std::to_string(i));
+	map.erase(1);
+	map.erase(map.find(3));
+
+	CHECK_EQ(map.size(), size_t(3));
+	CHECK(!map.contains(1));
+	CHECK(!map.contains(3));
+	CHECK_EQ(map.at(4), std::string("4"));
+	CHECK_EQ(map.find(4) - map.begin(), 2);
+	CHECK_EQ(map.count(0), size_t(1));
+}
+
+TEST(OrderedMap, InsertAtPosition)
+{
+	ordered_map<std::string, int> map;
+	map["b"] = 2;
+	map["c"] = 3;
+	map.insert(map.begin(), { "a", 1 });
+
+	CHECK_EQ(map.begin()->first, std::string("a"));
+	CHECK_EQ(map.at("c"), 3);
+	CHECK_EQ(map.find("b") - map.begin(), 1);
+}
+
+TEST(OrderedMap, ClearAndMissingKey)
+{
+	ordered_map<int, int> map;
+	map[1] = 1;
+	map.clear();
+	CHECK(map.empty());
+	CHECK(map.find(1) == map.end());
+	CHECK_THROWS(map.at(1), std::out_of_range);
+}
@@ -0,0 +1,104 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+TEST(Parallel, ParallelForCoversRangeOnce)
+{
+	rlx::ThreadPool pool(3);
+	std::vector<int> hits(10007, 0);
+	pool.ParallelFor(hits.size(), 64, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) ++hits[i];
+	});
+	CHECK(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+}
+
+TEST(Parallel, NestedCallsRunInlineAndExceptionsPropagate)
+{
+	rlx::ThreadPool pool(2);
+	std::atomic<int> total{ 0 };
+	pool.ParallelFor(8, 1, [&](size_t, size_t) {
+		pool.ParallelFor(4, 1, [&](size_t b, size_t e) { total += static_cast<int>(e - b); });
+	});
+	CHECK_EQ(total.load(), 32);
+
+	CHECK_THROWS(pool.ParallelFor(100, 1, [](size_t begin, size_t end) {
+		if (begin <= 42 && 42 < end) throw std::runtime_error("job failed");
+	}), std::runtime_error);
+}
+
+TEST(Parallel, InstanceCullingMatchesScalarReference)
+{
+	Mesh mesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+	Material material = LoadMaterialDefault();
+	rlx::InstanceBatch batch(mesh, material);
+
+	uint64_t seed = 12345;
+	auto next = [&]() { seed = seed * 6364136223846793005ull + 1442695040888963407ull; return (float)((seed >> 40) % 2000) / 10.0f - 100.0f; };
+	std::vector<Vector3> positions;
+	for (int i = 0; i < 50000; ++i) {
+		Vector3 p{ next(), next() * 0.2f, next() };
+		positions.push_back(p);
+		batch.Add(MatrixTranslate(p.x, p.y, p.z), 1.0f);
+	}
+
+	Camera3D camera{ { 0, 5, -50 }, { 0, 0, 0 }, { 0, 1, 0 }, 60.0f, CAMERA_PERSPECTIVE };
+	rlx::Frustum frustum = rlx::Frustum::FromCamera(camera, 16.0f / 9.0f);
+	rlx::ThreadPool pool(2);
+	batch.Cull(frustum, camera.position, pool);
+
+	size_t expected = 0;
+	for (const Vector3& p : positions)
+		if (frustum.ContainsSphere(p, 1.0f)) ++expected;
+	CHECK_EQ(batch.GetVisibleCount(), expected);
+	CHECK(expected > 0 && expected < positions.size());
+
+	batch.SetCullDistance(20.0f);
+	batch.Cull(frustum, camera.position, pool);
+	CHECK(batch.GetVisibleCount() < expected);
+
+	UnloadMaterial(material);
+	UnloadMesh(mesh);
+}
+
+TEST(Parallel, RemoveKeepsLodOfMovedInstance)
+{
+	Mesh mesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+	Material material = LoadMaterialDefault();
+	rlx::InstanceBatch batch(mesh, material);
+	batch.SetLodDistance(0, 10.0f);
+	batch.AddLod(mesh);
+
+	batch.Add(MatrixTranslate(0.0f, 0.0f, 5.0f), 1.0f);
+	batch.Add(MatrixTranslate(0.0f, 0.0f, 30.0f), 1.0f);
+	Camera3D camera{ { 0, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 }, 60.0f, CAMERA_PERSPECTIVE };
+	rlx::ThreadPool pool(2);
+	batch.Cull(rlx::Frustum::FromCamera(camera, 1.0f), camera.position, pool);
+	CHECK_EQ(batch.GetLod(0), 0);
+	CHECK_EQ(batch.GetLod(1), 1);
+
+	batch.Remove(0);	// the far instance moves into slot 0
+	CHECK_EQ(batch.GetLod(0), 1);
+
+	UnloadMaterial(material);
+	UnloadMesh(mesh);
+}
+
+TEST(Parallel, ParticlesIntegrateAndExpire)
+{
+	rlx::ParticleSystem particles(4096);
+	rlx::ParticleEmitter emitter;
+	emitter.velocityMin = { 10.0f, 0.0f };
+	emitter.velocityMax = { 10.0f, 0.0f };
+	emitter.lifetimeMin = 1.0f;
+	emitter.lifetimeMax = 1.0f;
+
+	CHECK_EQ(particles.Emit(emitter, 3000), size_t(3000));
+	CHECK_EQ(particles.Emit(emitter, 3000), size_t(1096));	// capped at capacity
+
+	particles.Update(0.5f);
+	CHECK_EQ(particles.Size(), size_t(4096));
+	CHECK_NEAR(particles.GetX()[0], 5.0f, 1e-4);
+	CHECK_NEAR(particles.GetLife()[0], 0.5f, 1e-4);
+
+	particles.Update(0.6f);
+	CHECK_EQ(particles.Size(), size_t(0));
+}
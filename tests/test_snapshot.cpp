@@ -0,0 +1,113 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+
+using namespace rlx;
+
+TEST(Snapshot, RoundTripMapsAndArrays)
+{
+	ordered_map<std::string, int> names;
+	names["zeta"] = 1;
+	names["alpha"] = 2;
+	names["mid"] = 3;
+	ordered_map<int, Rectangle<float>> rects;
+	rects[5] = Rectangle<float>(1, 2, 3, 4);
+	rects[-1] = Rectangle<float>(5, 6, 7, 8);
+	std::vector<Box<int>> boxes{ Box<int>(1, 2, 3, 4, { 1, 1, 1, 1 }, { 2, 2, 2, 2 }) };
+	std::vector<std::string> strings{ "a", "", "hello" };
+
+	Snapshot::Writer writer;
+	writer.WriteMap("names", names);
+	writer.WriteMap("rects", rects);
+	writer.WriteArray("boxes", boxes);
+	writer.WriteArray("strings", strings);
+	std::vector<uint8_t> data = writer.Finish();
+
+	Snapshot::Reader reader(data.data(), data.size());
+	CHECK_EQ(reader.GetSectionCount(), size_t(4));
+
+	auto nameView = reader.GetMap<std::string, int>("names");
+	REQUIRE(nameView.size() == 3);
+	CHECK(nameView.key(0) == "zeta");
+	CHECK(nameView.key(1) == "alpha");
+	CHECK_EQ(*nameView.find("mid"), 3);
+	CHECK(!nameView.contains("missing"));
+	ordered_map<std::string, int> copy = nameView.to_ordered_map();
+	CHECK_EQ(copy.begin()->first, std::string("zeta"));
+
+	auto rectView = reader.GetMap<int, Rectangle<float>>("rects");
+	CHECK(rectView.find(-1)->x == 5.0f);
+	CHECK_EQ(rectView.key(0), 5);
+
+	auto boxView = reader.GetArray<Box<int>>("boxes");
+	CHECK_EQ(boxView[0].margin.left, 2);
+	auto stringView = reader.GetArray<std::string>("strings");
+	CHECK(stringView[1].empty());
+	CHECK(stringView[2] == "hello");
+}
+
+TEST(Snapshot, RejectsMismatchedAndCorruptData)
+{
+	ordered_map<std::string, int> names;
+	names["a"] = 1;
+	Snapshot::Writer writer;
+	writer.WriteMap("names", names);
+	CHECK_THROWS(writer.WriteMap("names", names), std::invalid_argument);
+	std::vector<uint8_t> data = writer.Finish();
+
+	Snapshot::Reader reader(data.data(), data.size());
+	CHECK_THROWS((reader.GetMap<std::string, float>("names")), std::runtime_error);
+	CHECK_THROWS((reader.GetArray<int>("missing")), std::out_of_range);
+
+	CHECK_THROWS(Snapshot::Reader(data.data(), data.size() - 8), std::runtime_error);
+	std::vector<uint8_t> badMagic = data;
+	badMagic[0] = 'X';
+	CHECK_THROWS(Snapshot::Reader(badMagic.data(), badMagic.size()), std::runtime_error);
+}
+
+TEST(Snapshot, RejectsCorruptElementCounts)
+{
+	ordered_map<std::string, int> names;
+	names["a"] = 1;
+	names["b"] = 2;
+	std::vector<std::string> strings{ "x", "yz" };
+	std::vector<double> values{ 1.0, 2.0 };
+	Snapshot::Writer writer;
+	writer.WriteMap("names", names);
+	writer.WriteArray("strings", strings);
+	writer.WriteArray("values", values);
+	std::vector<uint8_t> data = writer.Finish();
+
+	// Counts that wrap the byte size computations back to something small, and ones just past the section
+	const uint64_t counts[] = { (uint64_t(1) << 62) - 1, uint64_t(1) << 61, uint64_t(1) << 63, 1000 };
+	for (uint64_t count : counts) {
+		std::vector<uint8_t> corrupt = data;
+		for (size_t i = 0; i < 3; ++i) {
+			const size_t at = sizeof(Snapshot::Header) + i * sizeof(Snapshot::SectionEntry) + offsetof(Snapshot::SectionEntry, count);
+			std::memcpy(corrupt.data() + at, &count, sizeof(count));
+		}
+		Snapshot::Reader reader(corrupt.data(), corrupt.size());
+		CHECK_THROWS((reader.GetMap<std::string, int>("names")), std::runtime_error);
+		CHECK_THROWS(reader.GetArray<std::string>("strings"), std::runtime_error);
+		CHECK_THROWS(reader.GetArray<double>("values"), std::runtime_error);
+	}
+}
+
+TEST(Snapshot, MemoryMappedFile)
+{
+	auto path = std::filesystem::temp_directory_path() / "rlx_snapshot_test.rlxs";
+	ordered_map<uint32_t, Padding<float>> pads;
+	for (uint32_t i = 0; i < 1000; ++i)
+		pads.push_back(1000 - i, Padding<float>{ (float)i, 0, 0, 0 });
+	Snapshot::Writer writer;
+	writer.WriteMap("pads", pads);
+	writer.Save(path);
+
+	{
+		Snapshot::Reader reader(path);
+		auto view = reader.GetMap<uint32_t, Padding<float>>("pads");
+		CHECK_EQ(view.size(), size_t(1000));
+		CHECK_EQ(view.find(1)->left, 999.0f);
+		CHECK_EQ(view.key(0), 1000u);
+	}
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,153 @@
+#include "rlx_test.h"
+#include "raylib_include.h"
+#include "headless.h"
+
+namespace {
+	Texture2D Tileset() {
+		Texture2D texture{};
+		texture.id = 1;
+		texture.width = 256;
+		texture.height = 256;
+		return texture;
+	}
+}
+
+TEST(TileMap, SetGetAndPaletteWidening)
+{
+	rlx::TileMap map(1000, 700, 16, Tileset(), 8);
+	for (int i = 0; i < 300; ++i)	// > 256 distinct ids in one chunk
+		map.SetTile(i % 32, i / 32, static_cast<rlx::TileMap::TileId>(i + 1));
+	map.Fill({ 40, 40, 100, 100 }, 7);
+
+	bool same = true;
+	for (int i = 0; i < 300; ++i)
+		same &= map.GetTile(i % 32, i / 32) == i + 1;
+	CHECK(same);
+	CHECK_EQ(map.GetTile(50, 50), 7);
+	CHECK_EQ(map.GetTile(500, 500), 0);
+	CHECK_EQ(map.GetTile(-1, 5), 0);
+
+	map.SetTile(50, 50, rlx::TileMap::EmptyTile);
+	CHECK_EQ(map.GetTile(50, 50), 0);
+}
+
+TEST(TileMap, PaletteCompactsInsteadOfWrapping)
+{
+	auto path = std::filesystem::temp_directory_path() / "rlx_tilemap_palette.rlxt";
+	{
+		rlx::TileMap map(64, 32, 16, Tileset(), 8);
+		for (int i = 0; i < 300; ++i)	// wide chunk
+			map.SetTile(i % 32, i / 32, static_cast<rlx::TileMap::TileId>(i + 1));
+		map.Fill({ 0, 0, 32, 32 }, 1);
+
+		// Every possible id passes through one tile; the palette would otherwise hold 65536 entries
+		for (int id = 2; id <= 65535; ++id)
+			map.SetTile(0, 0, static_cast<rlx::TileMap::TileId>(id));
+		map.SetTile(40, 3, 65534);
+		CHECK_EQ(map.GetTile(0, 0), 65535);
+		CHECK_EQ(map.GetTile(31, 31), 1);
+		map.Save(path);
+	}
+
+	auto map = rlx::TileMap::Open(path, 16, Tileset());
+	CHECK_EQ(map->GetTile(0, 0), 65535);
+	CHECK_EQ(map->GetTile(9, 9), 1);
+	CHECK_EQ(map->GetTile(40, 3), 65534);
+	CHECK_EQ(map->GetTile(41, 3), 0);
+	map.reset();
+	std::filesystem::remove(path);
+}
+
+TEST(TileMap, RebakesOnlyDirtyChunks)
+{
+	rlx::TileMap map(1000, 700, 16, Tileset(), 8);
+	map.Fill({ 0, 0, 64, 64 }, 3);
+	Camera2D camera{};
+	camera.zoom = 1.0f;
+
+	map.Prepare(camera, 800, 600);
+	CHECK_EQ(map.GetStats().visibleChunks, size_t(4));
+	CHECK_EQ(map.GetStats().bakesThisFrame, size_t(4));
+
+	map.Prepare(camera, 800, 600);
+	CHECK_EQ(map.GetStats().bakesThisFrame, size_t(0));
+
+	map.SetTile(40, 40, 5);
+	map.Prepare(camera, 800, 600);
+	CHECK_EQ(map.GetStats().bakesThisFrame, size_t(1));
+
+	HeadlessResetCounters();
+	map.Draw();
+	CHECK_EQ(HeadlessGetDrawCalls(), 4);	// one blit per chunk
+
+	camera.target = { 5000.0f, 5000.0f };
+	map.Prepare(camera, 800, 600);
+	CHECK_EQ(map.GetStats().visibleChunks, size_t(0));
+}
+
+TEST(TileMap, StreamsFromDisk)
+{
+	auto path = std::filesystem::temp_directory_path() / "rlx_tilemap_test.rlxt";
+	{
+		rlx::TileMap map(1000, 700, 16, Tileset(), 8);
+		map.Fill({ 40, 40, 100, 100 }, 7);
+		map.SetTile(999, 699, 9);
+		map.Save(path);
+	}
+
+	auto map = rlx::TileMap::Open(path, 16, Tileset(), 8);
+	const size_t resident = map->GetStats().loadedChunks;
+	CHECK_EQ(map->GetTile(60, 60), 7);
+	CHECK_EQ(map->GetTile(999, 699), 9);
+	CHECK(map->GetStats().loadedChunks > resident);
+
+	map->SetUnloadAfterFrames(2);
+	Camera2D camera{};
+	camera.zoom = 1.0f;
+	camera.target = { 20000.0f, 20000.0f };
+	for (int i = 0; i < 4; ++i)
+		map->Prepare(camera, 800, 600);
+	CHECK_EQ(map->GetStats().loadedChunks, resident);
+	CHECK_EQ(map->GetTile(60, 60), 7);	// reloaded on demand
+
+	std::filesystem::remove(path);
+	CHECK_THROWS(rlx::TileMap::Open(path, 16, Tileset()), std::runtime_error);
+}
+
+TEST(TileMap, SaveInPlaceKeepsStreaming)
+{
+	auto path = std::filesystem::temp_directory_path() / "rlx_tilemap_inplace.rlxt";
+	{
+		rlx::TileMap map(500, 300, 16, Tileset(), 8);
+		map.Fill({ 0, 0, 200, 100 }, 3);
+		map.SetTile(499, 299, 4);
+		map.Save(path);
+	}
+
+	auto map = rlx::TileMap::Open(path, 16, Tileset(), 8);
+	map->SetTile(10, 10, 5);
+	map->SetTile(300, 200, 6);	// a chunk that was empty on disk
+	map->Save(path);
+	CHECK(!std::filesystem::exists(path.string() + ".tmp"));
+
+	// Everything is on disk now, so every chunk can be evicted and read back from the rewritten file
+	const size_t resident = map->GetStats().loadedChunks;
+	map->SetUnloadAfterFrames(1);
+	Camera2D camera{};
+	camera.zoom = 1.0f;
+	camera.target = { 20000.0f, 20000.0f };
+	for (int i = 0; i < 3; ++i)
+		map->Prepare(camera, 800, 600);
+	CHECK(map->GetStats().loadedChunks < resident);
+	CHECK_EQ(map->GetTile(10, 10), 5);
+	CHECK_EQ(map->GetTile(11, 10), 3);
+	CHECK_EQ(map->GetTile(300, 200), 6);
+	CHECK_EQ(map->GetTile(499, 299), 4);
+
+	map.reset();
+	auto reopened = rlx::TileMap::Open(path, 16, Tileset());
+	CHECK_EQ(reopened->GetTile(10, 10), 5);
+	CHECK_EQ(reopened->GetTile(300, 200), 6);
+	reopened.reset();
+	std::filesystem::remove(path);
+}
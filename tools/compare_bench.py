@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Compare two rlx_bench JSON reports and flag regressions.
+
+    tools/compare_bench.py baseline.json current.json [--threshold 0.10] [--metric ns_per_op]
+
+Exits with status 1 when any benchmark present in both reports got slower by more than the
+threshold (a fraction: 0.10 = 10%). Benchmarks are matched on (name, size).
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        report = json.load(f)
+    if report.get("schema") != "rlx-bench/1":
+        sys.exit(f"{path}: unsupported schema {report.get('schema')!r}")
+    return {(r["name"], r["size"]): r for r in report["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10, help="allowed slowdown as a fraction (default 0.10)")
+    parser.add_argument("--metric", default="ns_per_op", choices=["ns_per_op", "ns_per_op_min"])
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print(f"{'benchmark':<40} {'size':>10} {'baseline':>12} {'current':>12} {'change':>9}")
+    for key in sorted(baseline.keys() & current.keys()):
+        old = baseline[key][args.metric]
+        new = current[key][args.metric]
+        change = (new - old) / old if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  faster"
+        print(f"{key[0]:<40} {key[1]:>10} {old:>12.2f} {new:>12.2f} {change:>+8.1%}{flag}")
+
+    for key in sorted(baseline.keys() - current.keys()):
+        print(f"{key[0]:<40} {key[1]:>10}  missing from current report")
+    for key in sorted(current.keys() - baseline.keys()):
+        print(f"{key[0]:<40} {key[1]:>10}  new")
+
+    if regressions:
+        print(f"\n{regressions} regression(s) above {args.threshold:.0%}")
+        return 1
+    print(f"\nno regressions above {args.threshold:.0%}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())